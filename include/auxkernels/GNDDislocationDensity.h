@@ -47,5 +47,10 @@ protected:
 
   const VariableValue & _rhos4;
 
+  /// Edge and screw GND densities of the total_net formulation
+  const VariableValue & _rhoe_gnd;
+
+  const VariableValue & _rhos_gnd;
+
   const Real _initial_total_dislo_den;
 };
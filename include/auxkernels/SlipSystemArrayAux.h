@@ -0,0 +1,40 @@
+//* This file is for continuum dislocation density field-based theory
+//* Zhangchen Fan
+//* Harbin Institute of Technology, Shenzhen
+//* Centre for Micro-mechanics Modelling and Characterisation
+//* 19 Oct 2026
+
+#pragma once
+
+#include "AuxKernel.h"
+
+/**
+ * SlipSystemArrayAux writes a per slip system quantity into the components of an elemental
+ * array variable, one component per slip system, so that a single object replaces one
+ * TotalDislocationDensity, GNDDislocationDensity or MaterialStdVectorAux per slip system.
+ * The total and GND densities are read from a DislocationDensityState and normalised by
+ * initial_total_dislo_den; the dislocation velocity and slip increment are the material
+ * properties of the crystal plasticity model.
+ */
+class SlipSystemArrayAux : public ArrayAuxKernel
+{
+public:
+  static InputParameters validParams();
+
+  SlipSystemArrayAux(const InputParameters & parameters);
+
+protected:
+  virtual RealEigenVector computeValue() override;
+
+  /// Quantity written into the array variable
+  const enum class Quantity { TOTAL, GND, VELOCITY, SLIP_INCREMENT } _quantity;
+
+  /// Density the total and GND densities are normalised by
+  const Real _initial_total_dislo_den;
+
+  /// Per slip system property, the edge GND density for gnd
+  const MaterialProperty<std::vector<Real>> & _property;
+
+  /// Screw GND density, only requested for gnd
+  const MaterialProperty<std::vector<Real>> * const _screw_gnd;
+};
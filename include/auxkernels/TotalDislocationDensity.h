@@ -47,5 +47,10 @@ protected:
 
   const VariableValue & _rhos4;
 
+  /// Edge and screw total densities of the total_net formulation
+  const VariableValue & _rhoe_total;
+
+  const VariableValue & _rhos_total;
+
   const Real _initial_total_dislo_den;
 };
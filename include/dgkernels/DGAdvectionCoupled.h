@@ -16,6 +16,11 @@ public:
 
   DGAdvectionCoupled(const InputParameters & parameters);
 
+  ///@{ Explicit transport only sees the old solution and adds nothing to the Jacobian
+  virtual void computeJacobian() override;
+  virtual void computeOffDiagJacobian(unsigned int jvar) override;
+  ///@}
+
 protected:
   virtual void getDislocationVelocity();
   virtual Real computeQpResidual(Moose::DGResidualType type) override;
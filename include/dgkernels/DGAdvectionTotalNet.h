@@ -0,0 +1,65 @@
+//* This file is for continuum dislocation density field-based theory
+//* Zhangchen Fan
+//* Harbin Institute of Technology, Shenzhen
+//* Centre for Micro-mechanics Modelling and Characterisation
+//* 19 Oct 2026
+
+#pragma once
+
+#include "DGKernel.h"
+
+/**
+ * DG upwinding for the total or GND density of one dislocation character on one slip system,
+ * the counterpart of ConservativeAdvectionSchmidTotalNet. The face flux of the positive
+ * density rho_+ = (rho_t + rho_g) / 2 is upwinded with v and the one of the negative density
+ * rho_- = (rho_t - rho_g) / 2 with -v. Their sum is the flux of the total density and their
+ * difference the flux of the GND density.
+ */
+class DGAdvectionTotalNet : public DGKernel
+{
+public:
+  static InputParameters validParams();
+
+  DGAdvectionTotalNet(const InputParameters & parameters);
+
+  ///@{ Explicit transport only sees the old solution and adds nothing to the Jacobian
+  virtual void computeJacobian() override;
+  virtual void computeOffDiagJacobian(unsigned int jvar) override;
+  ///@}
+
+protected:
+  virtual void getDislocationVelocity();
+  virtual Real computeQpResidual(Moose::DGResidualType type) override;
+  virtual Real computeQpJacobian(Moose::DGJacobianType type) override;
+  virtual Real computeQpOffDiagJacobian(Moose::DGJacobianType type, unsigned int jvar) override;
+
+  /// Derivative of the face flux with respect to the variable or to the paired density
+  Real signedFluxJacobian(Moose::DGJacobianType type, const bool paired);
+
+  /// advection velocity of the positive dislocations
+  RealVectorValue _velocity;
+
+  // Edge slip directions of all slip systems
+  const MaterialProperty<std::vector<Real>> & _edge_slip_direction;
+
+  // Screw slip directions of all slip systems
+  const MaterialProperty<std::vector<Real>> & _screw_slip_direction;
+
+  // Dislocation velocity value (signed) on all slip systems
+  const MaterialProperty<std::vector<Real>> & _dislo_velocity;
+
+  // Slip system index to determine slip direction
+  const unsigned int _slip_sys_index;
+
+  // Character of dislocations (edge or screw)
+  const enum class DisloCharacter { edge, screw } _dislo_character;
+
+  /// Whether this variable is the total or the GND density of the pair
+  const enum class DensityType { total, gnd } _density_type;
+
+  ///@{The other density of the pair in this and in the neighbouring element
+  const VariableValue & _paired_density;
+  const VariableValue & _paired_density_neighbor;
+  const unsigned int _paired_var;
+  ///@}
+};
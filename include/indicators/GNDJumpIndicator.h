@@ -0,0 +1,49 @@
+//* This file is for continuum dislocation density field-based theory
+//* Zhangchen Fan
+//* Harbin Institute of Technology, Shenzhen
+//* Centre for Micro-mechanics Modelling and Characterisation
+//* 19 Oct 2026
+
+#pragma once
+
+#include "InternalSideIndicator.h"
+
+/**
+ * GNDJumpIndicator measures the jump of the normalised GND density
+ * (sum of the positive minus sum of the negative densities, as in GNDDislocationDensity)
+ * across element faces. The gradient jump follows GradientJumpIndicator; the value jump
+ * picks up the discontinuities of DG (MONOMIAL) densities. Combined with
+ * ErrorFractionMarker or ErrorToleranceMarker it concentrates the elements in the
+ * dislocation boundary layers, where the backstress gradients live.
+ */
+class GNDJumpIndicator : public InternalSideIndicator
+{
+public:
+  static InputParameters validParams();
+
+  GNDJumpIndicator(const InputParameters & parameters);
+
+protected:
+  virtual Real computeQpIntegral() override;
+
+  /// Normalised GND density and its gradient on this and on the neighbour side
+  Real gnd(const std::vector<const VariableValue *> & positive,
+           const std::vector<const VariableValue *> & negative) const;
+  RealVectorValue gradGnd(const std::vector<const VariableGradient *> & positive,
+                          const std::vector<const VariableGradient *> & negative) const;
+
+  /// Measure the jump of the value or of the normal gradient
+  const enum class JumpType { GRADIENT, VALUE } _jump_type;
+
+  const Real _initial_total_dislo_den;
+
+  std::vector<const VariableValue *> _positive;
+  std::vector<const VariableValue *> _negative;
+  std::vector<const VariableValue *> _positive_neighbor;
+  std::vector<const VariableValue *> _negative_neighbor;
+
+  std::vector<const VariableGradient *> _grad_positive;
+  std::vector<const VariableGradient *> _grad_negative;
+  std::vector<const VariableGradient *> _grad_positive_neighbor;
+  std::vector<const VariableGradient *> _grad_negative_neighbor;
+};
@@ -0,0 +1,100 @@
+//* This file is for continuum dislocation density field-based theory
+//* Zhangchen Fan
+//* Harbin Institute of Technology, Shenzhen
+//* Centre for Micro-mechanics Modelling and Characterisation
+//* 19 Oct 2026
+
+#pragma once
+
+#include "Kernel.h"
+
+#include <array>
+
+/**
+ * Advection of the total density rho_t = rho_+ + rho_- or of the GND density
+ * rho_g = rho_+ - rho_- of one dislocation character on one slip system. The positive and
+ * negative dislocations move with opposite velocities, so the flux of the total density is
+ * v rho_g and the flux of the GND density is v rho_t: the two variables of a pair are coupled
+ * through the paired_density and replace the four quadrant densities of
+ * ConservativeAdvectionSchmid.
+ * Full upwinding is applied separately to rho_+ = (rho_t + rho_g) / 2 moving with v and
+ * rho_- = (rho_t - rho_g) / 2 moving with -v, which is the upwinding of the signed densities.
+ */
+class ConservativeAdvectionSchmidTotalNet : public Kernel
+{
+public:
+  static InputParameters validParams();
+
+  ConservativeAdvectionSchmidTotalNet(const InputParameters & parameters);
+
+protected:
+  virtual Real computeQpResidual() override;
+  virtual Real computeQpJacobian() override;
+  virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
+  virtual void computeResidual() override;
+  virtual void computeJacobian() override;
+  virtual void computeOffDiagJacobian(unsigned int jvar) override;
+
+  /// enum to make the code clearer
+  enum class JacRes
+  {
+    CALCULATE_RESIDUAL = 0,
+    CALCULATE_JACOBIAN = 1
+  };
+
+  // Edge slip directions of all slip systems
+  const MaterialProperty<std::vector<Real>> & _edge_slip_direction;
+
+  // Screw slip directions of all slip systems
+  const MaterialProperty<std::vector<Real>> & _screw_slip_direction;
+
+  // Dislocation velocity value (signed) on all slip systems
+  const MaterialProperty<std::vector<Real>> & _dislo_velocity;
+
+  /// Type of upwinding
+  const enum class UpwindingType { none, full } _upwinding;
+
+  // Slip system index to determine slip direction
+  const unsigned int _slip_sys_index;
+
+  // Character of dislocations (edge or screw)
+  const enum class DisloCharacter { edge, screw } _dislo_character;
+
+  /// Whether this variable is the total or the GND density of the pair
+  const enum class DensityType { total, gnd } _density_type;
+
+  // is statistically stored dislocations considered
+  const enum class SSDInclude { yes, no } _is_ssd_inclued;
+
+  /// SSD increment of the dislocation character, only with is_ssd_included = yes
+  const MaterialProperty<std::vector<Real>> * const _dislocation_increment;
+
+  ///@{The other density of the pair: the GND density for the total density and vice versa
+  const VariableValue & _paired_density;
+  const unsigned int _paired_var;
+  const VariableValue & _paired_nodal;
+  ///@}
+
+  /// Nodal value of u, used for full upwinding
+  const VariableValue & _u_nodal;
+
+  /// In the full-upwind scheme, whether a node is an upwind node
+  std::vector<bool> _upwind_node;
+
+  /// In the full-upwind scheme d(total_mass_out)/d(variable_at_node_i)
+  std::vector<Real> _dtotal_mass_out;
+
+  ///@{Full-upwind residual and Jacobian of the positive [0] and negative [1] densities
+  std::array<DenseVector<Number>, 2> _signed_re;
+  std::array<DenseMatrix<Number>, 2> _signed_ke;
+  ///@}
+
+  /// Returns - _grad_test * velocity of the positive dislocations
+  Real negSpeedQp();
+
+  /**
+   * Fully-upwinded residual (of the nodal signed density) or Jacobian (with respect to the
+   * nodal signed density) of the positive (sign = 1) or negative (sign = -1) dislocations
+   */
+  void fullUpwind(const Real sign, JacRes res_or_jac);
+};
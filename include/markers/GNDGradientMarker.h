@@ -0,0 +1,36 @@
+//* This file is for continuum dislocation density field-based theory
+//* Zhangchen Fan
+//* Harbin Institute of Technology, Shenzhen
+//* Centre for Micro-mechanics Modelling and Characterisation
+//* 19 Oct 2026
+
+#pragma once
+
+#include "QuadraturePointMarker.h"
+
+/**
+ * GNDGradientMarker marks elements by the variation of the normalised GND density
+ * across them, h * |grad(rho_GND)| / rho_0. Elements above the refine threshold are
+ * refined and elements below the coarsen threshold are coarsened, so that the mesh
+ * follows the dislocation boundary layer as it forms. Because the measure scales
+ * with the element size, refinement stops once the layer is resolved.
+ */
+class GNDGradientMarker : public QuadraturePointMarker
+{
+public:
+  static InputParameters validParams();
+
+  GNDGradientMarker(const InputParameters & parameters);
+
+protected:
+  virtual MarkerValue computeQpMarker() override;
+
+  const Real _initial_total_dislo_den;
+
+  const Real _refine;
+  const bool _do_coarsening;
+  const Real _coarsen;
+
+  std::vector<const VariableGradient *> _grad_positive;
+  std::vector<const VariableGradient *> _grad_negative;
+};
@@ -14,6 +14,11 @@
 #include "RankTwoTensor.h"
 #include "RankFourTensor.h"
 
+#include "libmesh/dense_matrix.h"
+#include "libmesh/dense_vector.h"
+
+#include <unordered_map>
+
 /**
  * ComputeCrystalPlasticityDislocationStress (used together with
  * CrystalPlasticityDislocationUpdateBase) uses the multiplicative decomposition of the deformation
@@ -34,6 +39,12 @@ public:
 
   virtual void initialSetup() override;
 
+  /// Drops the lagged tangents, the elements and their points may have changed
+  virtual void meshChanged() override;
+
+  /// Number of tangent moduli built by this (thread's) object since the start of the run
+  unsigned long numTangentEvaluations() const { return _num_tangent_evaluations; }
+
 protected:
   virtual void computeQpStress() override;
 
@@ -70,6 +81,47 @@ protected:
    */
   void solveQp();
 
+  /// Solve the stress and internal state variables over one substep without accepting them
+  void solveSubstep();
+
+  /// Accept a converged substep as the start of the next one
+  void acceptSubstep();
+
+  /**
+   * Integrate over the time step with substeps sized from a local error estimate: the backward
+   * Euler slip increments are compared with the trapezoidal rule using the slip rates at both
+   * ends of the substep. Substeps above the tolerance are repeated with a smaller size, accepted
+   * substeps set the size of the next one.
+   */
+  void solveErrorControlledSubsteps();
+
+  /**
+   * Estimated local error of the last substep relative to its tolerance, the largest over the
+   * slip systems of the error divided by the absolute tolerance plus the relative tolerance
+   * times the magnitude of the slip increment. A value above one rejects the substep.
+   */
+  Real substepError() const;
+
+  /**
+   * Lockstep PK2 Newton iteration over all quadrature points of the current element for a full
+   * time step, with the slip rates and their derivatives of all points evaluated by one batched
+   * call into the model. Marks the points that converged in _batch_converged.
+   */
+  void solveElementBatch();
+
+  /**
+   * Completes the batched solve at the current point: a regular residual evaluation at the
+   * converged stress and the state-variable update. Returns false when the point has to be
+   * solved point-wise.
+   */
+  bool finalizeBatchedQp();
+
+  /**
+   * Update of the state variables of all models after a stress solve. Returns whether they
+   * have converged; constitutive failures are flagged in _convergence_failed.
+   */
+  bool updateConstitutiveStateVariables();
+
   /**
    * Save the final stress and internal variable values after the iterative solve.
    */
@@ -81,6 +133,14 @@ protected:
    */
   void solveStateVariables();
 
+  /**
+   * Alternative to solveStress for a single model without eigenstrains: a Newton iteration on
+   * the slip increments of the active slip systems only, those with a nonzero slip rate or
+   * increment, with the active set updated between iterations. The system size follows the
+   * number of active systems instead of the 9 PK2 components with contributions of all systems.
+   */
+  void solveStressActiveSet();
+
   /**
    * solves for stress, updates plastic deformation gradient.
    */
@@ -94,6 +154,9 @@ protected:
    */
   void calculateResidual();
 
+  /// Stress residual for a given sum of the slip increments times their Schmid tensors
+  void calculateResidual(const RankTwoTensor & equivalent_slip_increment);
+
   /**
    * Calculates the jacobian as
    * $\mathbf{J} = \mathbf{I} - \mathbf{C} \frac{d\mathbf{E}^e}{d\mathbf{F}^e}
@@ -101,8 +164,14 @@ protected:
    */
   void calculateJacobian();
 
+  /// Jacobian for a given derivative of F^{p-1} with respect to PK2
+  void calculateJacobian(const RankFourTensor & dfpinvdpk2);
+
   ///@{Calculates the tangent moduli for use as a preconditioner, using the elastic or elastic-plastic option as specified by the user
   void calcTangentModuli(RankFourTensor & jacobian_mult);
+
+  /// Exact tangent of the current point, rebuilt for the element every tangent_lag iterations
+  void laggedTangentModuli(RankFourTensor & jacobian_mult);
   void elasticTangentModuli(RankFourTensor & jacobian_mult);
   void elastoPlasticTangentModuli(RankFourTensor & jacobian_mult);
   ///@}
@@ -151,9 +220,75 @@ protected:
   /// Type of tangent moduli calculation
   const enum class TangentModuliType { EXACT, NONE } _tan_mod_type;
 
+  /// When the tangent moduli are evaluated: only for Jacobian assembly, or always
+  const enum class TangentEvaluation { AUTO, ALWAYS } _tangent_evaluation;
+
+  /// Whether the current evaluation needs the tangent moduli
+  bool needTangentModuli() const;
+
+  /// Whether the time integrator is explicit, so that only the mass matrix is assembled
+  bool _explicit_time_integration;
+
+  /// Number of tangent moduli built
+  unsigned long _num_tangent_evaluations;
+
+  /// Number of nonlinear iterations an exact tangent is reused for
+  const unsigned int _tangent_lag;
+
+  /// Tangents of the points of an element and the solve and nonlinear iteration they were built at
+  struct LaggedTangent
+  {
+    std::vector<RankFourTensor> tangent;
+    Real time = 0.0;
+    unsigned int nonlinear_iteration = 0;
+    bool refresh = true;
+  };
+
+  /// Lagged tangents by element id
+  std::unordered_map<dof_id_type, LaggedTangent> _lagged_tangent;
+
+  /// Stress solve of the nested loops: on the PK2 stress or on the active slip increments
+  const enum class LocalSolver { NESTED, ACTIVE_SET } _local_solver;
+
+  /// Whether the stress of all quadrature points of an element is solved together
+  const bool _batched_update;
+
+  ///@{ Points still iterating, converged points, and per-point data of the batched solve
+  std::vector<unsigned int> _batch_qps;
+  std::vector<bool> _batch_converged;
+  std::vector<bool> _batch_failed;
+  std::vector<Real> _batch_dslip_dtau;
+  std::vector<Real> _batch_rnorm0;
+  std::vector<RankTwoTensor> _batch_inverse_plastic_deformation_grad_old;
+  ///@}
+
+  ///@{ Slip increments, active systems and Newton system of the active-set stress solve
+  std::vector<Real> _active_set_slip_increment;
+  std::vector<unsigned int> _active_systems;
+  std::vector<RankTwoTensor> _active_set_dpk2;
+  std::vector<Real> _active_set_dslip_dtau;
+  DenseVector<Real> _active_set_residual;
+  DenseVector<Real> _active_set_update;
+  DenseMatrix<Real> _active_set_jacobian;
+  ///@}
+
   /// Maximum number of substep iterations
   unsigned int _max_substep_iter;
 
+  /// Restart with more equal substeps after a failure, or adapt the substep to the error
+  const enum class Substepping { BISECTION, ERROR_CONTROL } _substepping;
+
+  ///@{ Absolute and relative tolerance of the estimated slip increment error of a substep
+  const Real _substep_error_tolerance;
+  const Real _substep_relative_error_tolerance;
+  ///@}
+
+  /// Smallest error-controlled substep as a fraction of the time step
+  const Real _minimum_substep_fraction;
+
+  /// Slip rates of every model at the start of the current substep
+  std::vector<std::vector<Real>> _substep_start_slip_rate;
+
   /// time step size during substepping
   Real _substep_dt;
 
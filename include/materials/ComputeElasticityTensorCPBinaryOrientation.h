@@ -0,0 +1,34 @@
+//* This file is for continuum dislocation density field-based theory
+//* Zhangchen Fan
+//* Harbin Institute of Technology, Shenzhen
+//* Centre for Micro-mechanics Modelling and Characterisation
+//* 19 Oct 2026
+
+#pragma once
+
+#include "ComputeElasticityTensorCP.h"
+
+class BinaryOrientationReader;
+
+/**
+ * ComputeElasticityTensorCPBinaryOrientation takes the Euler angles of every element from a
+ * BinaryOrientationReader, so that the crystal rotation used by the crystal plasticity models
+ * and by the slip direction computations is set per element instead of per block.
+ * The grain id of the element is stored in the grain_id material property.
+ */
+class ComputeElasticityTensorCPBinaryOrientation : public ComputeElasticityTensorCP
+{
+public:
+  static InputParameters validParams();
+
+  ComputeElasticityTensorCPBinaryOrientation(const InputParameters & parameters);
+
+protected:
+  virtual void assignEulerAngles() override;
+
+  /// Per-element orientations
+  const BinaryOrientationReader & _orientation_reader;
+
+  /// Grain id of the element
+  MaterialProperty<Real> & _grain_id;
+};
@@ -97,6 +97,15 @@ protected:
    */
   virtual void calculateSlipResistance() override;
 
+  /**
+   * Copies the coupled edge densities of the current qp into the member scratch,
+   * optionally setting densities below zero_tol to zero
+   */
+  void gatherEdgeDislocationDensities(const bool clip);
+
+  /// Slip resistance of the gathered edge densities through the latent hardening matrix
+  void calculateHardeningSlipResistance();
+
   /**
    * Calculates the accumulated plastic strain and stored energy density
    */
@@ -108,6 +117,9 @@ protected:
    */
   virtual bool areConstitutiveStateVariablesConverged() override;
 
+  /// The densities are coupled variables, the slip resistance is fixed within the time step
+  virtual bool hasConstitutiveStateVariables() const override { return false; }
+
   ///@{Varibles used in the Busso 1992 slip system resistance constiutive model
   const Real _r;
   const Real _temperature;
@@ -128,6 +140,20 @@ protected:
   DenseVector<Real> _backstress;
   ///@}
 
+  ///@{Edge densities of the current qp, gathered once per iteration and reused by the
+  /// slip resistance, slip rate and dislocation velocity without reallocating
+  std::vector<Real> _rho_edge_pos;
+  std::vector<Real> _rho_edge_neg;
+  ///@}
+
+  /// Latent hardening matrix with self hardening w1 + 1 - w2 and latent hardening w1
+  SlipInteractionMatrix _latent_hardening;
+
+  ///@{Total and hardening (h_ij rho_j) densities of each slip system
+  std::vector<Real> _total_density;
+  std::vector<Real> _hardening_density;
+  ///@}
+
   ///@{Nodal degrees of freedom
   const VariableValue & _edge_dislo_den_pos_1;
 
@@ -7,6 +7,7 @@
 #pragma once
 
 #include "CrystalPlasticityDislocationUpdateBase.h"
+#include "BussoSlipKernel.h"
 
 class CrystalPlasticityBussoUpdateFCC;
 
@@ -25,6 +26,8 @@ public:
 
   CrystalPlasticityBussoUpdateFCC(const InputParameters & parameters);
 
+  virtual void initialSetup() override;
+
 protected:
   /**
    * initializes the stateful properties such as
@@ -66,6 +69,15 @@ protected:
 
   virtual void calculateConstitutiveSlipDerivative(std::vector<Real> & dslip_dtau) override;
 
+  /**
+   * The slip resistance and the backstress only depend on the coupled densities, so they are
+   * gathered point by point and the flow rule is evaluated for all slip systems of all points in
+   * one BussoFlowRule::slipRates sweep.
+   */
+  virtual void calculateSlipRates(const std::vector<unsigned int> & qps,
+                                  std::vector<Real> & dslip_dtau,
+                                  std::vector<bool> & failed) override;
+
   // Cache the slip system value before the update for the diff in the convergence check
   virtual void cacheStateVariablesBeforeUpdate() override;
 
@@ -102,12 +114,21 @@ protected:
    */
   void calculateAccumulatedEquivalentPlasticStrain();
 
+  /// Sums the edge and screw densities of all quadrants (or both totals) into _total_density
+  void calculateTotalDislocationDensity();
+
+  /// Gradients of the edge and screw GND densities into _grad_edge_gnd and _grad_screw_gnd
+  void calculateGNDGradients();
+
   /*
    * Determines if the state variables, e.g. edge densities, have converged
    * by comparing the change in the values over the iteration period.
    */
   virtual bool areConstitutiveStateVariablesConverged() override;
 
+  /// The densities are coupled variables, the slip resistance is fixed within the time step
+  virtual bool hasConstitutiveStateVariables() const override { return false; }
+
   ///@{Varibles used in the Busso 1992 slip system resistance constiutive model
   const Real _r;
   const Real _temperature;
@@ -128,211 +149,47 @@ protected:
   DenseVector<Real> _backstress;
   ///@}
 
-  ///@{Nodal degrees of freedom
-  const VariableValue & _edge_dislo_den_1_Q1;
-  const VariableGradient & _grad_edge_dislo_den_1_Q1;
-  const VariableValue & _edge_dislo_den_1_Q2;
-  const VariableGradient & _grad_edge_dislo_den_1_Q2;
-  const VariableValue & _edge_dislo_den_1_Q3;
-  const VariableGradient & _grad_edge_dislo_den_1_Q3;
-  const VariableValue & _edge_dislo_den_1_Q4;
-  const VariableGradient & _grad_edge_dislo_den_1_Q4;
-  const VariableValue & _screw_dislo_den_1_Q1;
-  const VariableGradient & _grad_screw_dislo_den_1_Q1;
-  const VariableValue & _screw_dislo_den_1_Q2;
-  const VariableGradient & _grad_screw_dislo_den_1_Q2;
-  const VariableValue & _screw_dislo_den_1_Q3;
-  const VariableGradient & _grad_screw_dislo_den_1_Q3;
-  const VariableValue & _screw_dislo_den_1_Q4;
-  const VariableGradient & _grad_screw_dislo_den_1_Q4;
-
-  const VariableValue & _edge_dislo_den_2_Q1;
-  const VariableGradient & _grad_edge_dislo_den_2_Q1;
-  const VariableValue & _edge_dislo_den_2_Q2;
-  const VariableGradient & _grad_edge_dislo_den_2_Q2;
-  const VariableValue & _edge_dislo_den_2_Q3;
-  const VariableGradient & _grad_edge_dislo_den_2_Q3;
-  const VariableValue & _edge_dislo_den_2_Q4;
-  const VariableGradient & _grad_edge_dislo_den_2_Q4;
-  const VariableValue & _screw_dislo_den_2_Q1;
-  const VariableGradient & _grad_screw_dislo_den_2_Q1;
-  const VariableValue & _screw_dislo_den_2_Q2;
-  const VariableGradient & _grad_screw_dislo_den_2_Q2;
-  const VariableValue & _screw_dislo_den_2_Q3;
-  const VariableGradient & _grad_screw_dislo_den_2_Q3;
-  const VariableValue & _screw_dislo_den_2_Q4;
-  const VariableGradient & _grad_screw_dislo_den_2_Q4;
-
-  const VariableValue & _edge_dislo_den_3_Q1;
-  const VariableGradient & _grad_edge_dislo_den_3_Q1;
-  const VariableValue & _edge_dislo_den_3_Q2;
-  const VariableGradient & _grad_edge_dislo_den_3_Q2;
-  const VariableValue & _edge_dislo_den_3_Q3;
-  const VariableGradient & _grad_edge_dislo_den_3_Q3;
-  const VariableValue & _edge_dislo_den_3_Q4;
-  const VariableGradient & _grad_edge_dislo_den_3_Q4;
-  const VariableValue & _screw_dislo_den_3_Q1;
-  const VariableGradient & _grad_screw_dislo_den_3_Q1;
-  const VariableValue & _screw_dislo_den_3_Q2;
-  const VariableGradient & _grad_screw_dislo_den_3_Q2;
-  const VariableValue & _screw_dislo_den_3_Q3;
-  const VariableGradient & _grad_screw_dislo_den_3_Q3;
-  const VariableValue & _screw_dislo_den_3_Q4;
-  const VariableGradient & _grad_screw_dislo_den_3_Q4;
-
-  const VariableValue & _edge_dislo_den_4_Q1;
-  const VariableGradient & _grad_edge_dislo_den_4_Q1;
-  const VariableValue & _edge_dislo_den_4_Q2;
-  const VariableGradient & _grad_edge_dislo_den_4_Q2;
-  const VariableValue & _edge_dislo_den_4_Q3;
-  const VariableGradient & _grad_edge_dislo_den_4_Q3;
-  const VariableValue & _edge_dislo_den_4_Q4;
-  const VariableGradient & _grad_edge_dislo_den_4_Q4;
-  const VariableValue & _screw_dislo_den_4_Q1;
-  const VariableGradient & _grad_screw_dislo_den_4_Q1;
-  const VariableValue & _screw_dislo_den_4_Q2;
-  const VariableGradient & _grad_screw_dislo_den_4_Q2;
-  const VariableValue & _screw_dislo_den_4_Q3;
-  const VariableGradient & _grad_screw_dislo_den_4_Q3;
-  const VariableValue & _screw_dislo_den_4_Q4;
-  const VariableGradient & _grad_screw_dislo_den_4_Q4;
-
-  const VariableValue & _edge_dislo_den_5_Q1;
-  const VariableGradient & _grad_edge_dislo_den_5_Q1;
-  const VariableValue & _edge_dislo_den_5_Q2;
-  const VariableGradient & _grad_edge_dislo_den_5_Q2;
-  const VariableValue & _edge_dislo_den_5_Q3;
-  const VariableGradient & _grad_edge_dislo_den_5_Q3;
-  const VariableValue & _edge_dislo_den_5_Q4;
-  const VariableGradient & _grad_edge_dislo_den_5_Q4;
-  const VariableValue & _screw_dislo_den_5_Q1;
-  const VariableGradient & _grad_screw_dislo_den_5_Q1;
-  const VariableValue & _screw_dislo_den_5_Q2;
-  const VariableGradient & _grad_screw_dislo_den_5_Q2;
-  const VariableValue & _screw_dislo_den_5_Q3;
-  const VariableGradient & _grad_screw_dislo_den_5_Q3;
-  const VariableValue & _screw_dislo_den_5_Q4;
-  const VariableGradient & _grad_screw_dislo_den_5_Q4;
-
-  const VariableValue & _edge_dislo_den_6_Q1;
-  const VariableGradient & _grad_edge_dislo_den_6_Q1;
-  const VariableValue & _edge_dislo_den_6_Q2;
-  const VariableGradient & _grad_edge_dislo_den_6_Q2;
-  const VariableValue & _edge_dislo_den_6_Q3;
-  const VariableGradient & _grad_edge_dislo_den_6_Q3;
-  const VariableValue & _edge_dislo_den_6_Q4;
-  const VariableGradient & _grad_edge_dislo_den_6_Q4;
-  const VariableValue & _screw_dislo_den_6_Q1;
-  const VariableGradient & _grad_screw_dislo_den_6_Q1;
-  const VariableValue & _screw_dislo_den_6_Q2;
-  const VariableGradient & _grad_screw_dislo_den_6_Q2;
-  const VariableValue & _screw_dislo_den_6_Q3;
-  const VariableGradient & _grad_screw_dislo_den_6_Q3;
-  const VariableValue & _screw_dislo_den_6_Q4;
-  const VariableGradient & _grad_screw_dislo_den_6_Q4;
-
-  const VariableValue & _edge_dislo_den_7_Q1;
-  const VariableGradient & _grad_edge_dislo_den_7_Q1;
-  const VariableValue & _edge_dislo_den_7_Q2;
-  const VariableGradient & _grad_edge_dislo_den_7_Q2;
-  const VariableValue & _edge_dislo_den_7_Q3;
-  const VariableGradient & _grad_edge_dislo_den_7_Q3;
-  const VariableValue & _edge_dislo_den_7_Q4;
-  const VariableGradient & _grad_edge_dislo_den_7_Q4;
-  const VariableValue & _screw_dislo_den_7_Q1;
-  const VariableGradient & _grad_screw_dislo_den_7_Q1;
-  const VariableValue & _screw_dislo_den_7_Q2;
-  const VariableGradient & _grad_screw_dislo_den_7_Q2;
-  const VariableValue & _screw_dislo_den_7_Q3;
-  const VariableGradient & _grad_screw_dislo_den_7_Q3;
-  const VariableValue & _screw_dislo_den_7_Q4;
-  const VariableGradient & _grad_screw_dislo_den_7_Q4;
-
-  const VariableValue & _edge_dislo_den_8_Q1;
-  const VariableGradient & _grad_edge_dislo_den_8_Q1;
-  const VariableValue & _edge_dislo_den_8_Q2;
-  const VariableGradient & _grad_edge_dislo_den_8_Q2;
-  const VariableValue & _edge_dislo_den_8_Q3;
-  const VariableGradient & _grad_edge_dislo_den_8_Q3;
-  const VariableValue & _edge_dislo_den_8_Q4;
-  const VariableGradient & _grad_edge_dislo_den_8_Q4;
-  const VariableValue & _screw_dislo_den_8_Q1;
-  const VariableGradient & _grad_screw_dislo_den_8_Q1;
-  const VariableValue & _screw_dislo_den_8_Q2;
-  const VariableGradient & _grad_screw_dislo_den_8_Q2;
-  const VariableValue & _screw_dislo_den_8_Q3;
-  const VariableGradient & _grad_screw_dislo_den_8_Q3;
-  const VariableValue & _screw_dislo_den_8_Q4;
-  const VariableGradient & _grad_screw_dislo_den_8_Q4;
-
-  const VariableValue & _edge_dislo_den_9_Q1;
-  const VariableGradient & _grad_edge_dislo_den_9_Q1;
-  const VariableValue & _edge_dislo_den_9_Q2;
-  const VariableGradient & _grad_edge_dislo_den_9_Q2;
-  const VariableValue & _edge_dislo_den_9_Q3;
-  const VariableGradient & _grad_edge_dislo_den_9_Q3;
-  const VariableValue & _edge_dislo_den_9_Q4;
-  const VariableGradient & _grad_edge_dislo_den_9_Q4;
-  const VariableValue & _screw_dislo_den_9_Q1;
-  const VariableGradient & _grad_screw_dislo_den_9_Q1;
-  const VariableValue & _screw_dislo_den_9_Q2;
-  const VariableGradient & _grad_screw_dislo_den_9_Q2;
-  const VariableValue & _screw_dislo_den_9_Q3;
-  const VariableGradient & _grad_screw_dislo_den_9_Q3;
-  const VariableValue & _screw_dislo_den_9_Q4;
-  const VariableGradient & _grad_screw_dislo_den_9_Q4;
-
-  const VariableValue & _edge_dislo_den_10_Q1;
-  const VariableGradient & _grad_edge_dislo_den_10_Q1;
-  const VariableValue & _edge_dislo_den_10_Q2;
-  const VariableGradient & _grad_edge_dislo_den_10_Q2;
-  const VariableValue & _edge_dislo_den_10_Q3;
-  const VariableGradient & _grad_edge_dislo_den_10_Q3;
-  const VariableValue & _edge_dislo_den_10_Q4;
-  const VariableGradient & _grad_edge_dislo_den_10_Q4;
-  const VariableValue & _screw_dislo_den_10_Q1;
-  const VariableGradient & _grad_screw_dislo_den_10_Q1;
-  const VariableValue & _screw_dislo_den_10_Q2;
-  const VariableGradient & _grad_screw_dislo_den_10_Q2;
-  const VariableValue & _screw_dislo_den_10_Q3;
-  const VariableGradient & _grad_screw_dislo_den_10_Q3;
-  const VariableValue & _screw_dislo_den_10_Q4;
-  const VariableGradient & _grad_screw_dislo_den_10_Q4;
-
-  const VariableValue & _edge_dislo_den_11_Q1;
-  const VariableGradient & _grad_edge_dislo_den_11_Q1;
-  const VariableValue & _edge_dislo_den_11_Q2;
-  const VariableGradient & _grad_edge_dislo_den_11_Q2;
-  const VariableValue & _edge_dislo_den_11_Q3;
-  const VariableGradient & _grad_edge_dislo_den_11_Q3;
-  const VariableValue & _edge_dislo_den_11_Q4;
-  const VariableGradient & _grad_edge_dislo_den_11_Q4;
-  const VariableValue & _screw_dislo_den_11_Q1;
-  const VariableGradient & _grad_screw_dislo_den_11_Q1;
-  const VariableValue & _screw_dislo_den_11_Q2;
-  const VariableGradient & _grad_screw_dislo_den_11_Q2;
-  const VariableValue & _screw_dislo_den_11_Q3;
-  const VariableGradient & _grad_screw_dislo_den_11_Q3;
-  const VariableValue & _screw_dislo_den_11_Q4;
-  const VariableGradient & _grad_screw_dislo_den_11_Q4;
-
-  const VariableValue & _edge_dislo_den_12_Q1;
-  const VariableGradient & _grad_edge_dislo_den_12_Q1;
-  const VariableValue & _edge_dislo_den_12_Q2;
-  const VariableGradient & _grad_edge_dislo_den_12_Q2;
-  const VariableValue & _edge_dislo_den_12_Q3;
-  const VariableGradient & _grad_edge_dislo_den_12_Q3;
-  const VariableValue & _edge_dislo_den_12_Q4;
-  const VariableGradient & _grad_edge_dislo_den_12_Q4;
-  const VariableValue & _screw_dislo_den_12_Q1;
-  const VariableGradient & _grad_screw_dislo_den_12_Q1;
-  const VariableValue & _screw_dislo_den_12_Q2;
-  const VariableGradient & _grad_screw_dislo_den_12_Q2;
-  const VariableValue & _screw_dislo_den_12_Q3;
-  const VariableGradient & _grad_screw_dislo_den_12_Q3;
-  const VariableValue & _screw_dislo_den_12_Q4;
-  const VariableGradient & _grad_screw_dislo_den_12_Q4;
+  /// Slip system update specialised on the slip system count and the mesh dimension
+  const std::unique_ptr<BussoSlipKernelBase> _slip_kernel;
+
+  /// Latent hardening matrix with self hardening w1 + 1 - w2 and latent hardening w1
+  SlipInteractionMatrix _latent_hardening;
+
+  ///@{Per slip system input buffers of the slip kernel
+  Real * const _total_density;
+  RealVectorValue * const _grad_edge_gnd;
+  RealVectorValue * const _grad_screw_gnd;
+  RealVectorValue * const _inverse_edge_direction;
+  RealVectorValue * const _inverse_screw_direction;
+  ///@}
+
+  ///@{Effective resolved shear stress, slip resistance and slip rate of all batched points
+  std::vector<Real> _batch_tau_eff;
+  std::vector<Real> _batch_slip_resistance;
+  std::vector<Real> _batch_slip_rate;
+  ///@}
+
+  /// Transported densities: four quadrant densities or the total and GND density per character
+  const enum class DensityFormulation { quadrant, total_net } _density_formulation;
+
+  ///@{Coupled densities and their gradients, indexed [quadrant][slip system]
+  std::array<std::vector<const VariableValue *>, 4> _edge_density;
+  std::array<std::vector<const VariableGradient *>, 4> _grad_edge_density;
+  std::array<std::vector<const VariableValue *>, 4> _screw_density;
+  std::array<std::vector<const VariableGradient *>, 4> _grad_screw_density;
+  ///@}
+
+  ///@{Coupled total densities and GND density gradients of the total_net formulation
+  std::vector<const VariableValue *> _edge_total_density;
+  std::vector<const VariableValue *> _screw_total_density;
+  std::vector<const VariableGradient *> _grad_edge_gnd_density;
+  std::vector<const VariableGradient *> _grad_screw_gnd_density;
+  ///@}
 
+  ///@{Densities and GND gradients of a DislocationDensityState, if dislocation_state is set
+  const MaterialProperty<std::vector<Real>> * _state_total_density;
+  const MaterialProperty<std::vector<RealVectorValue>> * _state_grad_edge_gnd;
+  const MaterialProperty<std::vector<RealVectorValue>> * _state_grad_screw_gnd;
   ///@}
 
   // Rotated slip direction to couple with dislocation transport
@@ -0,0 +1,99 @@
+//* This file is for continuum dislocation density field-based theory
+//* Zhangchen Fan
+//* Harbin Institute of Technology, Shenzhen
+//* Centre for Micro-mechanics Modelling and Characterisation
+//* 19 Oct 2026
+
+#pragma once
+
+#include "CrystalPlasticityDislocationUpdateBase.h"
+#include "SparseSlipInteractionMatrix.h"
+
+/**
+ * CrystalPlasticityBussoUpdateGeneric is Busso's dislocation density based slip law for an
+ * arbitrary number of slip systems, e.g. the 48 BCC or the multi-family HCP slip systems
+ * read by CrystalPlasticityDislocationUpdateBase. Every slip system couples one total
+ * density and, optionally, one signed edge GND density for the backstress. The latent
+ * hardening matrix is dense (every pair interacts at least through w1), and reduces to a single
+ * sum over the densities when its latent coefficients are uniform. The backstress coupling,
+ * the identity unless the backstress_*_interaction parameters are given, is a sparse matrix so
+ * its cost scales with the number of nonzero interactions.
+ */
+class CrystalPlasticityBussoUpdateGeneric : public CrystalPlasticityDislocationUpdateBase
+{
+public:
+  static InputParameters validParams();
+
+  CrystalPlasticityBussoUpdateGeneric(const InputParameters & parameters);
+
+protected:
+  virtual void initQpStatefulProperties() override;
+
+  /// Also stores the rotated edge and screw slip directions for the dislocation transport
+  virtual void calculateSchmidTensor(const unsigned int & number_dislocation_systems,
+                                     const std::vector<RealVectorValue> & plane_normal_vector,
+                                     const std::vector<RealVectorValue> & direction_vector,
+                                     std::vector<RankTwoTensor> & schmid_tensor,
+                                     const RankTwoTensor & crysrot) override;
+
+  virtual bool calculateSlipRate() override;
+
+  /// Exact derivative of the slip rate with respect to the resolved shear stress
+  virtual void calculateConstitutiveSlipDerivative(std::vector<Real> & dslip_dtau) override;
+
+  /// tau_c_i = dlamb * mu * b * sqrt(sum_j h_ij rho_j) with the dense hardening matrix
+  virtual void calculateSlipResistance() override;
+
+  /// The densities are coupled variables, there is no internal state to update
+  virtual bool updateStateVariables() override { return true; }
+  virtual bool hasConstitutiveStateVariables() const override { return false; }
+
+  /// Backstress of every slip system, coupled through the sparse backstress matrix
+  void calculateBackstress();
+
+  /// Velocity of the dislocations on each slip system, slip rate / (b * rho)
+  void calculateDislocationVelocity();
+
+  ///@{Constants of Busso's flow rule and of the Taylor hardening
+  const Real _temperature;
+  const Real _p;
+  const Real _q;
+  const Real _f0;
+  const Real _gdot0;
+  const Real _tau_0;
+  const Real _burgers;
+  const Real _shear_modulus;
+  const Real _boltzmann;
+  const Real _scaling_Cb;
+  const Real _dlamb;
+  const Real _w1;
+  const Real _w2;
+  ///@}
+
+  ///@{Coupled total densities and, if given, edge GND density gradients of each slip system
+  const std::vector<const VariableValue *> _total_densities;
+  const bool _has_gnd;
+  std::vector<const VariableGradient *> _grad_gnd_densities;
+  ///@}
+
+  /// Latent hardening matrix (self w1 + 1 - w2, latent w1 or the *_interaction parameters)
+  SlipInteractionMatrix _latent_hardening;
+
+  /// Backstress coupling between the slip systems, the identity by default
+  SparseSlipInteractionMatrix _backstress_interaction;
+
+  ///@{Per slip system work arrays
+  std::vector<Real> _total_density;
+  std::vector<Real> _hardening_density;
+  std::vector<Real> _self_backstress;
+  std::vector<Real> _backstress;
+  ///@}
+
+  ///@{Rotated edge slip directions and edge line (screw slip) directions
+  MaterialProperty<std::vector<Real>> & _edge_slip_direction;
+  MaterialProperty<std::vector<Real>> & _screw_slip_direction;
+  ///@}
+
+  /// Dislocation velocity of each slip system
+  MaterialProperty<std::vector<Real>> & _dislo_velocity;
+};
@@ -7,6 +7,7 @@
 #pragma once
 
 #include "CrystalPlasticityDislocationUpdateBase.h"
+#include "BussoSlipKernel.h"
 
 class CrystalPlasticityBussoUpdateMultiSlip;
 
@@ -102,12 +103,18 @@ protected:
    */
   void calculateAccumulatedEquivalentPlasticStrain();
 
+  /// Sums the positive and negative edge densities into _total_density
+  void calculateTotalDislocationDensity();
+
   /*
    * Determines if the state variables, e.g. edge densities, have converged
    * by comparing the change in the values over the iteration period.
    */
   virtual bool areConstitutiveStateVariablesConverged() override;
 
+  /// The densities are coupled variables, the slip resistance is fixed within the time step
+  virtual bool hasConstitutiveStateVariables() const override { return false; }
+
   ///@{Varibles used in the Busso 1992 slip system resistance constiutive model
   const Real _r;
   const Real _temperature;
@@ -125,7 +132,7 @@ protected:
   const Real _w1;
   const Real _w2;
 
-  DenseVector<Real> _backstress;
+  /// Backstress including the interaction between the slip systems
   DenseVector<Real> _backstress_total;
   ///@}
 
@@ -192,4 +199,18 @@ protected:
   const enum class TwoSlipCheck { yes, no } _is_two_slips;
 
   const enum class MultiSlipsVersion { v_1, v_2, v_3 } _version_number;
+
+  /// Slip system update specialised on the slip system count, mesh dimension and version
+  const std::unique_ptr<BussoSlipKernelBase> _slip_kernel;
+
+  /// Latent hardening matrix with self hardening w1 + 1 - w2 and latent hardening w1
+  SlipInteractionMatrix _latent_hardening;
+
+  ///@{Per slip system input buffers of the slip kernel
+  Real * const _total_density;
+  RealVectorValue * const _grad_edge_gnd;
+  ///@}
+
+  /// Inverse of the (fixed) in-plane slip directions the backstress is projected on
+  RealVectorValue * const _inverse_edge_direction;
 };
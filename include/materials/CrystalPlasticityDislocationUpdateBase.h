@@ -9,7 +9,8 @@
 #include "Material.h"
 #include "RankTwoTensor.h"
 #include "RankFourTensor.h"
-#include "DelimitedFileReader.h"
+#include "SlipInteractionMatrix.h"
+#include "SlipSystemRegistry.h"
 
 /**
  * CrystalPlasticityDislocationUpdateBase is modified from CrystalPlasticityStressUpdateBase
@@ -32,6 +33,12 @@ public:
   /// Sets the value of the _substep_dt for inheriting classes
   void setSubstepDt(const Real & substep_dt);
 
+  ///@{ Number of slip systems, and their Schmid tensors and slip rates at the current qp
+  unsigned int numberSlipSystems() const { return _number_slip_systems; }
+  const std::vector<RankTwoTensor> & flowDirection() const { return _flow_direction[_qp]; }
+  const std::vector<Real> & slipRate() const { return _slip_increment[_qp]; }
+  ///@}
+
   ///@{ Retained as empty methods to avoid a warning from Material.C in framework. These methods are unused in all inheriting classes and should not be overwritten.
   virtual void resetQpProperties() final {}
   virtual void resetProperties() final {}
@@ -45,19 +52,13 @@ public:
   virtual void initQpStatefulProperties() override;
 
   /**
-   * A helper method to read in plane normal and direction vectors from a file
-   * and to normalize the vectors. This method is abstracted to allow for reuse
-   * in inheriting classes with multiple plane normal and direction vector pairs.
+   * A helper method to get the normalized plane normal and direction vectors, either from the
+   * slip_system_registry or from the process-wide cache of SlipSystemRegistry, which reads each
+   * file only once. This method is abstracted to allow for reuse in inheriting classes with
+   * multiple plane normal and direction vector pairs.
    */
   virtual void getSlipSystems();
 
-  /**
-   * A helper method to transform the Miller-Bravais 4-index notation for HCP
-   * crystals into a a 3-index Cartesian representation, using the convention
-   * a$_1$ = x of axis alignment in the basal plane
-   */
-  void transformHexagonalMillerBravaisSlipSystems(const MooseUtils::DelimitedFileReader & reader);
-
   /**
    * Computes the Schmid tensor (m x n) for the original (reference) crystal
    * lattice orientation for each glide slip system
@@ -83,6 +84,32 @@ public:
       const RankTwoTensor & inverse_eigenstrain_deformation_grad_old,
       const unsigned int & num_eigenstrains);
 
+  /**
+   * Sum over the slip systems of $\frac{d\mathbf{F}^P^{-1}}{d\mathbf{PK2}}$ for given slip rate
+   * derivatives dslip_dtau[j * stride], shared by the point-wise and the batched updates
+   */
+  void plasticDeformationGradientDerivative(
+      RankFourTensor & dfpinvdpk2,
+      const Real * dslip_dtau,
+      const unsigned int stride,
+      const RankTwoTensor & inverse_plastic_deformation_grad_old,
+      const RankTwoTensor & inverse_eigenstrain_deformation_grad_old,
+      const unsigned int & num_eigenstrains) const;
+
+  /**
+   * Batched calculateSlipRate and calculateConstitutiveSlipDerivative at the quadrature points
+   * qps of the current element, with the resolved shear stresses already set at every point.
+   * Only the slip rates are stored in the material property; the derivatives are returned slip
+   * system by slip system, dslip_dtau[i * qps.size() + p], and failed[p] flags the points whose
+   * slip increment exceeds the tolerance. The caller finishes every point with a regular
+   * calculateSlipRate, which sets the remaining per-point quantities. The default evaluates the
+   * points one by one; models with a point-wise flow rule override it to evaluate all slip
+   * systems of all points at once.
+   */
+  virtual void calculateSlipRates(const std::vector<unsigned int> & qps,
+                                  std::vector<Real> & dslip_dtau,
+                                  std::vector<bool> & failed);
+
   /**
    * A helper method to rotate the a direction and plane normal system set into
    * the local crystal llatice orientation as defined by the crystal rotation
@@ -115,6 +142,19 @@ public:
    */
   unsigned int identifyCrossSlipFamily(const unsigned int index);
 
+  /**
+   * Assembles the interaction matrix of the slip systems from the cached pair
+   * classification, with the given self hardening coefficient. The coplanar, collinear and
+   * junction coefficients are taken from the *_interaction parameters and default to latent.
+   */
+  void buildSlipInteractionMatrix(const Real self,
+                                  const Real latent,
+                                  SlipInteractionMatrix & matrix) const;
+
+  /// Coefficients of the interaction types, see buildSlipInteractionMatrix
+  SlipInteractionMatrix::Coefficients slipInteractionCoefficients(const Real self,
+                                                                  const Real latent) const;
+
   /**
    * This virtual method is called to set the constitutive internal state variables
    * current value and the previous substep value to the old property value for
@@ -153,7 +193,8 @@ public:
    * This virtual method is called to find the derivative of the slip increment
    * with respect to the applied shear stress on the slip system based on the
    * constiutive model defined in the child class.  This method must be overwritten
-   * in the child class.
+   * in the child class. Like _slip_increment, which stores the slip rate, the derivative is
+   * taken per unit time: the callers multiply it by the substep size.
    */
   virtual void calculateConstitutiveSlipDerivative(std::vector<Real> & /*dslip_dtau*/) = 0;
 
@@ -179,6 +220,13 @@ public:
    */
   virtual bool areConstitutiveStateVariablesConverged() { return true; }
 
+  /**
+   * Whether the model integrates internal state variables in the local solve, so that its slip
+   * resistance changes with the slip increments of the current time step. The batched update
+   * keeps the slip resistance of a time step fixed and only supports models without them.
+   */
+  virtual bool hasConstitutiveStateVariables() const { return true; }
+
   /**
    * Check if a typical state variable, e.g. defect density, has converged
    * by comparing the change in the values over the iteration period.
@@ -203,6 +251,9 @@ protected:
   /// File should contain slip plane normal and direction.
   std::string _slip_sys_file_name;
 
+  /// Shared slip system definition, used instead of the file if given
+  const SlipSystemRegistry * const _slip_system_registry;
+
   /// @{Parameters to characterize the cross slip behavior of the crystal
   const Real _number_cross_slip_directions;
   const Real _number_cross_slip_planes;
@@ -231,12 +282,20 @@ protected:
   MaterialProperty<std::vector<RankTwoTensor>> & _flow_direction;
   ///@}
 
+  ///@{Slip directions and normals rotated into the sample frame, reused by calculateSchmidTensor
+  std::vector<RealVectorValue> _local_direction_vector;
+  std::vector<RealVectorValue> _local_plane_normal;
+  ///@}
+
   /// Resolved shear stress on each slip system
   MaterialProperty<std::vector<Real>> & _tau;
 
   /// Flag to print to console warning messages on stress, constitutive model convergence
   const bool _print_convergence_message;
 
+  /// Slip rate derivatives of the plastic deformation gradient derivative, reused at every qp
+  std::vector<Real> _dslip_dtau;
+
   /// Substepping time step value used within the inheriting constitutive models
   Real _substep_dt;
 
@@ -245,4 +304,7 @@ protected:
 
   /// Flag to run the cross slip calculations if cross slip numbers are specified
   bool _calculate_cross_slip;
+
+  /// Row-major coplanar/collinear/junction classification of all slip system pairs
+  std::vector<SlipInteractionMatrix::InteractionType> _slip_interaction_types;
 };
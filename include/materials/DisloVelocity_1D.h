@@ -23,7 +23,8 @@ public:
 protected:
   virtual void computeQpProperties() override;
 
-  virtual void initQpStatefulProperties();
+  /// Only called if another object requests the old dislocation velocity
+  virtual void initQpStatefulProperties() override;
 
   const unsigned int _nss;
 
@@ -54,8 +55,6 @@ protected:
 private:
   /// member variable to hold the computed diffusivity coefficient
   MaterialProperty<std::vector<Real>> & _dislo_velocity;
-  /// member variable to hold the computed convection velocity gradient term
-  const MaterialProperty<std::vector<Real>> & _velocity_old;
 
   const VariableValue & _rhoep;
 
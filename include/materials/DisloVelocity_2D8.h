@@ -20,10 +20,13 @@ public:
 
   static InputParameters validParams();
 
+  virtual void initialSetup() override;
+
 protected:
   virtual void computeQpProperties() override;
 
-  virtual void initQpStatefulProperties();
+  /// Only called if another object requests the old dislocation velocity
+  virtual void initQpStatefulProperties() override;
 
   const unsigned int _nss;
 
@@ -56,8 +59,6 @@ protected:
 private:
   /// member variable to hold the computed diffusivity coefficient
   MaterialProperty<std::vector<Real>> & _dislo_velocity;
-  /// member variable to hold the computed convection velocity gradient term
-  const MaterialProperty<std::vector<Real>> & _velocity_old;
 
   const VariableValue & _edge_dislo_den_1;
 
@@ -102,4 +103,11 @@ private:
   MaterialProperty<Real> & _rhot;
 
   MaterialProperty<Real> & _tau_backstress;
+
+  ///@{Densities and GND gradients of a DislocationDensityState, if dislocation_state is set
+  const MaterialProperty<std::vector<Real>> * const _state_edge_density;
+  const MaterialProperty<std::vector<Real>> * const _state_screw_density;
+  const MaterialProperty<std::vector<RealVectorValue>> * const _state_grad_edge_gnd;
+  const MaterialProperty<std::vector<RealVectorValue>> * const _state_grad_screw_gnd;
+  ///@}
 };
@@ -0,0 +1,76 @@
+//* This file is for continuum dislocation density field-based theory
+//* Zhangchen Fan
+//* Harbin Institute of Technology, Shenzhen
+//* Centre for Micro-mechanics Modelling and Characterisation
+//* 19 Oct 2026
+
+#pragma once
+
+#include "Material.h"
+
+#include <array>
+
+/**
+ * DislocationDensityState gathers the transported dislocation densities once per quadrature
+ * point and publishes, per slip system, the edge, screw and total densities, the edge and screw
+ * GND densities and their gradients. CrystalPlasticityBussoUpdateFCC, SSDUpdate and
+ * DisloVelocity_2D8 read these properties when their dislocation_state parameter is set,
+ * instead of each coupling and summing the same quadrant densities.
+ *
+ * With the quadrant formulation the GND densities are edge Q1 + Q2 - Q3 - Q4 and
+ * screw Q1 - Q2 - Q3 + Q4; with total_net they are the transported GND densities.
+ */
+class DislocationDensityState : public Material
+{
+public:
+  static InputParameters validParams();
+
+  DislocationDensityState(const InputParameters & parameters);
+
+  /**
+   * Checks, in the initialSetup of a material reading the published properties, that a
+   * DislocationDensityState publishing at least number_slip_systems slip systems is active on
+   * every block of the reader.
+   */
+  static void checkReader(const MaterialBase & reader,
+                          const FEProblemBase & problem,
+                          const unsigned int number_slip_systems,
+                          const THREAD_ID tid);
+
+protected:
+  virtual void computeQpProperties() override;
+
+  /// Evaluates the densities for the initialization of stateful properties that depend on them
+  virtual void initQpStatefulProperties() override;
+
+  const unsigned int _number_slip_systems;
+
+  /// Transported densities: four quadrant densities or the total and GND density per character
+  const enum class DensityFormulation { quadrant, total_net } _density_formulation;
+
+  ///@{Coupled quadrant densities and gradients indexed [quadrant][slip]
+  std::array<std::vector<const VariableValue *>, 4> _edge_density;
+  std::array<std::vector<const VariableGradient *>, 4> _grad_edge_density;
+  std::array<std::vector<const VariableValue *>, 4> _screw_density;
+  std::array<std::vector<const VariableGradient *>, 4> _grad_screw_density;
+  ///@}
+
+  ///@{Coupled total and GND densities of the total_net formulation
+  std::vector<const VariableValue *> _edge_total_density;
+  std::vector<const VariableValue *> _edge_gnd_density;
+  std::vector<const VariableGradient *> _grad_edge_gnd_density;
+  std::vector<const VariableValue *> _screw_total_density;
+  std::vector<const VariableValue *> _screw_gnd_density;
+  std::vector<const VariableGradient *> _grad_screw_gnd_density;
+  ///@}
+
+  ///@{Published densities of each slip system
+  MaterialProperty<std::vector<Real>> & _edge_dislocation_density;
+  MaterialProperty<std::vector<Real>> & _screw_dislocation_density;
+  MaterialProperty<std::vector<Real>> & _total_dislocation_density;
+  MaterialProperty<std::vector<Real>> & _edge_gnd;
+  MaterialProperty<std::vector<Real>> & _screw_gnd;
+  MaterialProperty<std::vector<RealVectorValue>> & _grad_edge_gnd;
+  MaterialProperty<std::vector<RealVectorValue>> & _grad_screw_gnd;
+  ///@}
+};
@@ -5,6 +5,8 @@
 // A helper class from MOOSE that linear interpolates x,y data
 #include "DerivativeMaterialInterface.h"
 
+#include <array>
+
 /**
  * Material objects inherit from Material and override computeQpProperties.
  *
@@ -18,12 +20,22 @@ public:
 
   SSDUpdate(const InputParameters & parameters);
 
+  virtual void initialSetup() override;
+
 protected:
   /// Necessary override. This is where the values of the properties are computed.
   virtual void computeQpProperties();
   virtual void initQpStatefulProperties();
 
 private:
+  /**
+   * Computes the SSD increments of all slip systems at the current qp as
+   * old + rate * dt, where a null old value stands for zero.
+   */
+  void computeQpDislocationIncrement(const std::vector<Real> * edge_increment_old,
+                                     const std::vector<Real> * screw_increment_old,
+                                     const Real dt);
+
   const Real _burgers;
   const Real _ke_b;
   const Real _ks_b;
@@ -34,135 +46,32 @@ private:
 
   const unsigned int _nss;
 
-  std::vector<Real> _gssT;
+  /// Whether the increments are accumulated over time steps, which makes them stateful
+  const bool _accumulate_increment;
 
-  // for a FCC, there are 12 slips inside
-  // thus, here gives a completed variables
-  // variable value of Slip 1
-  const VariableValue & _edge_dislo_den_1_Q1;
-  const VariableValue & _edge_dislo_den_1_Q2;
-  const VariableValue & _edge_dislo_den_1_Q3;
-  const VariableValue & _edge_dislo_den_1_Q4;
-  const VariableValue & _screw_dislo_den_1_Q1;
-  const VariableValue & _screw_dislo_den_1_Q2;
-  const VariableValue & _screw_dislo_den_1_Q3;
-  const VariableValue & _screw_dislo_den_1_Q4;
-
-  // variable value of Slip 2
-  const VariableValue & _edge_dislo_den_2_Q1;
-  const VariableValue & _edge_dislo_den_2_Q2;
-  const VariableValue & _edge_dislo_den_2_Q3;
-  const VariableValue & _edge_dislo_den_2_Q4;
-  const VariableValue & _screw_dislo_den_2_Q1;
-  const VariableValue & _screw_dislo_den_2_Q2;
-  const VariableValue & _screw_dislo_den_2_Q3;
-  const VariableValue & _screw_dislo_den_2_Q4;
-
-  // variable value of Slip 3
-  const VariableValue & _edge_dislo_den_3_Q1;
-  const VariableValue & _edge_dislo_den_3_Q2;
-  const VariableValue & _edge_dislo_den_3_Q3;
-  const VariableValue & _edge_dislo_den_3_Q4;
-  const VariableValue & _screw_dislo_den_3_Q1;
-  const VariableValue & _screw_dislo_den_3_Q2;
-  const VariableValue & _screw_dislo_den_3_Q3;
-  const VariableValue & _screw_dislo_den_3_Q4;
-
-  // variable value of Slip 4
-  const VariableValue & _edge_dislo_den_4_Q1;
-  const VariableValue & _edge_dislo_den_4_Q2;
-  const VariableValue & _edge_dislo_den_4_Q3;
-  const VariableValue & _edge_dislo_den_4_Q4;
-  const VariableValue & _screw_dislo_den_4_Q1;
-  const VariableValue & _screw_dislo_den_4_Q2;
-  const VariableValue & _screw_dislo_den_4_Q3;
-  const VariableValue & _screw_dislo_den_4_Q4;
-
-  // variable value of Slip 5
-  const VariableValue & _edge_dislo_den_5_Q1;
-  const VariableValue & _edge_dislo_den_5_Q2;
-  const VariableValue & _edge_dislo_den_5_Q3;
-  const VariableValue & _edge_dislo_den_5_Q4;
-  const VariableValue & _screw_dislo_den_5_Q1;
-  const VariableValue & _screw_dislo_den_5_Q2;
-  const VariableValue & _screw_dislo_den_5_Q3;
-  const VariableValue & _screw_dislo_den_5_Q4;
-
-  // variable value of Slip 6
-  const VariableValue & _edge_dislo_den_6_Q1;
-  const VariableValue & _edge_dislo_den_6_Q2;
-  const VariableValue & _edge_dislo_den_6_Q3;
-  const VariableValue & _edge_dislo_den_6_Q4;
-  const VariableValue & _screw_dislo_den_6_Q1;
-  const VariableValue & _screw_dislo_den_6_Q2;
-  const VariableValue & _screw_dislo_den_6_Q3;
-  const VariableValue & _screw_dislo_den_6_Q4;
-
-  // variable value of Slip 7
-  const VariableValue & _edge_dislo_den_7_Q1;
-  const VariableValue & _edge_dislo_den_7_Q2;
-  const VariableValue & _edge_dislo_den_7_Q3;
-  const VariableValue & _edge_dislo_den_7_Q4;
-  const VariableValue & _screw_dislo_den_7_Q1;
-  const VariableValue & _screw_dislo_den_7_Q2;
-  const VariableValue & _screw_dislo_den_7_Q3;
-  const VariableValue & _screw_dislo_den_7_Q4;
-
-  // variable value of Slip 8
-  const VariableValue & _edge_dislo_den_8_Q1;
-  const VariableValue & _edge_dislo_den_8_Q2;
-  const VariableValue & _edge_dislo_den_8_Q3;
-  const VariableValue & _edge_dislo_den_8_Q4;
-  const VariableValue & _screw_dislo_den_8_Q1;
-  const VariableValue & _screw_dislo_den_8_Q2;
-  const VariableValue & _screw_dislo_den_8_Q3;
-  const VariableValue & _screw_dislo_den_8_Q4;
-
-  // variable value of Slip 9
-  const VariableValue & _edge_dislo_den_9_Q1;
-  const VariableValue & _edge_dislo_den_9_Q2;
-  const VariableValue & _edge_dislo_den_9_Q3;
-  const VariableValue & _edge_dislo_den_9_Q4;
-  const VariableValue & _screw_dislo_den_9_Q1;
-  const VariableValue & _screw_dislo_den_9_Q2;
-  const VariableValue & _screw_dislo_den_9_Q3;
-  const VariableValue & _screw_dislo_den_9_Q4;
-
-  // variable value of Slip 10
-  const VariableValue & _edge_dislo_den_10_Q1;
-  const VariableValue & _edge_dislo_den_10_Q2;
-  const VariableValue & _edge_dislo_den_10_Q3;
-  const VariableValue & _edge_dislo_den_10_Q4;
-  const VariableValue & _screw_dislo_den_10_Q1;
-  const VariableValue & _screw_dislo_den_10_Q2;
-  const VariableValue & _screw_dislo_den_10_Q3;
-  const VariableValue & _screw_dislo_den_10_Q4;
-
-  // variable value of Slip 11
-  const VariableValue & _edge_dislo_den_11_Q1;
-  const VariableValue & _edge_dislo_den_11_Q2;
-  const VariableValue & _edge_dislo_den_11_Q3;
-  const VariableValue & _edge_dislo_den_11_Q4;
-  const VariableValue & _screw_dislo_den_11_Q1;
-  const VariableValue & _screw_dislo_den_11_Q2;
-  const VariableValue & _screw_dislo_den_11_Q3;
-  const VariableValue & _screw_dislo_den_11_Q4;
-
-  // variable value of Slip 12
-  const VariableValue & _edge_dislo_den_12_Q1;
-  const VariableValue & _edge_dislo_den_12_Q2;
-  const VariableValue & _edge_dislo_den_12_Q3;
-  const VariableValue & _edge_dislo_den_12_Q4;
-  const VariableValue & _screw_dislo_den_12_Q1;
-  const VariableValue & _screw_dislo_den_12_Q2;
-  const VariableValue & _screw_dislo_den_12_Q3;
-  const VariableValue & _screw_dislo_den_12_Q4;
+  std::vector<Real> _gssT;
 
   const MaterialProperty<std::vector<Real>> & _slip_increment;
 
   MaterialProperty<std::vector<Real>> & _edge_dislocation_increment;
-  const MaterialProperty<std::vector<Real>> & _edge_dislocation_increment_old;
+  /// Old increments, only requested (nullptr otherwise) if _accumulate_increment is set
+  const MaterialProperty<std::vector<Real>> * const _edge_dislocation_increment_old;
 
   MaterialProperty<std::vector<Real>> & _screw_dislocation_increment;
-  const MaterialProperty<std::vector<Real>> & _screw_dislocation_increment_old;
+  const MaterialProperty<std::vector<Real>> * const _screw_dislocation_increment_old;
+
+  ///@{Coupled densities of the first nss slip systems indexed [quadrant][slip]
+  std::array<std::vector<const VariableValue *>, 4> _edge_dislo_den;
+  std::array<std::vector<const VariableValue *>, 4> _screw_dislo_den;
+  ///@}
+
+  ///@{Densities of a DislocationDensityState, only requested if dislocation_state is set
+  const MaterialProperty<std::vector<Real>> * const _state_edge_density;
+  const MaterialProperty<std::vector<Real>> * const _state_screw_density;
+  ///@}
+
+  ///@{Edge and screw densities of each slip system at the current qp, sized once to nss
+  std::vector<Real> _edge_dislocation_density;
+  std::vector<Real> _screw_dislocation_density;
+  ///@}
 };
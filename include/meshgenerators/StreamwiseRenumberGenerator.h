@@ -0,0 +1,32 @@
+//* This file is for continuum dislocation density field-based theory
+//* Zhangchen Fan
+//* Harbin Institute of Technology, Shenzhen
+//* Centre for Micro-mechanics Modelling and Characterisation
+//* 19 Oct 2026
+
+#pragma once
+
+#include "MeshGenerator.h"
+
+/**
+ * Renumbers the elements and nodes of the input mesh consecutively along its
+ * principal axis. libMesh distributes the degrees of freedom in element and node
+ * order, so the transport blocks of quasi-1D meshes end up with a narrow band.
+ * Combine with allow_renumbering = false in [Mesh] so the order is kept.
+ */
+class StreamwiseRenumberGenerator : public MeshGenerator
+{
+public:
+  static InputParameters validParams();
+
+  StreamwiseRenumberGenerator(const InputParameters & parameters);
+
+  std::unique_ptr<MeshBase> generate() override;
+
+protected:
+  /// Mesh to renumber
+  std::unique_ptr<MeshBase> & _input;
+
+  /// Requested streamwise axis, or auto
+  const MooseEnum _axis;
+};
@@ -0,0 +1,69 @@
+//* This file is for continuum dislocation density field-based theory
+//* Zhangchen Fan
+//* Harbin Institute of Technology, Shenzhen
+//* Centre for Micro-mechanics Modelling and Characterisation
+//* 19 Oct 2026
+
+#pragma once
+
+#include "FileOutput.h"
+
+#include <cstdint>
+#include <fstream>
+
+/**
+ * BinaryLineSampleOutput appends the vectors of line samplers (or any vector postprocessor with
+ * a fixed length) at every output time to a single binary file, instead of one CSV file per
+ * sampler and time step. The file, read by scripts/read_line_samples.py, holds a 64 byte header
+ *
+ *   char     magic[8]         "CDFLSP01"
+ *   uint64_t number_frames    frames completely written, updated after every frame
+ *   uint32_t number_columns
+ *   uint32_t number_points    length of every vector
+ *   uint64_t data_offset      start of the first frame
+ *   uint64_t frame_size       bytes per frame, 8 * (1 + number_columns * number_points)
+ *   uint64_t reserved[3]
+ *
+ * followed by number_columns 64 byte column names "sampler/vector", zero padded, and by the
+ * frames. A frame is the time followed by the columns one after the other
+ *
+ *   double   time
+ *   double   values[number_columns][number_points]
+ *
+ * in little endian byte order. Every column is contiguous within a frame and frames have a
+ * constant size, so a mapped file is a (frames, columns, points) array behind the time. The
+ * frame count is written last, so the file can be mapped and read while the run appends to it.
+ */
+class BinaryLineSampleOutput : public FileOutput
+{
+public:
+  static InputParameters validParams();
+
+  BinaryLineSampleOutput(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual std::string filename() override;
+
+  static constexpr std::size_t header_size = 64;
+  static constexpr std::size_t column_name_size = 64;
+
+protected:
+  virtual void output() override;
+
+  /// Fixes the number of points and writes the header on the first output
+  void initializeFile();
+
+  /// Vector postprocessors whose vectors are written
+  const std::vector<VectorPostprocessorName> & _samplers;
+
+  /// Sampler and vector name of every column
+  std::vector<std::pair<std::string, std::string>> _columns;
+
+  std::size_t _number_points;
+  std::uint64_t _number_frames;
+
+  /// Frame buffer, written with a single call
+  std::vector<double> _frame;
+
+  std::fstream _stream;
+};
@@ -0,0 +1,33 @@
+//* This file is for continuum dislocation density field-based theory
+//* Zhangchen Fan
+//* Harbin Institute of Technology, Shenzhen
+//* Centre for Micro-mechanics Modelling and Characterisation
+//* 19 Oct 2026
+
+#pragma once
+
+#include "MoosePartitioner.h"
+
+class MooseMesh;
+
+/**
+ * StripPartitioner cuts quasi-1D meshes (e.g. the single-column boundary layer
+ * meshes) into contiguous strips along their principal axis. Every rank owns one
+ * block of consecutive elements, so each processor boundary cuts only the faces
+ * between two strips and DG face coupling needs a single ghost layer per side.
+ */
+class StripPartitioner : public MoosePartitioner
+{
+public:
+  static InputParameters validParams();
+
+  StripPartitioner(const InputParameters & params);
+
+  virtual std::unique_ptr<Partitioner> clone() const override;
+
+protected:
+  virtual void _do_partition(MeshBase & mesh, const unsigned int n) override;
+
+  /// Requested strip axis, or the longest bounding-box extent when set to auto
+  const MooseEnum _axis;
+};
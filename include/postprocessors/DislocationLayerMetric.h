@@ -0,0 +1,83 @@
+//* This file is for continuum dislocation density field-based theory
+//* Zhangchen Fan
+//* Harbin Institute of Technology, Shenzhen
+//* Centre for Micro-mechanics Modelling and Characterisation
+//* 19 Oct 2026
+
+#pragma once
+
+#include "ElementPostprocessor.h"
+
+/**
+ * DislocationLayerMetric evaluates a boundary layer or pile-up measure during the run, so that
+ * the layer thickness, the peak GND density or the plastic zone size are recorded every time
+ * step as one column of the postprocessor CSV instead of being extracted offline from full
+ * field or line sampler output.
+ *
+ * The field is the normalised GND density |sum(positive) - sum(negative)| / rho_0, as in
+ * GNDDislocationDensity, or the normalised sum of all coupled variables (e.g. the total
+ * density, or the equivalent plastic strain for the plastic zone). It is sampled at the
+ * quadrature points together with the distance from a reference plane, the wall of the
+ * boundary layer or the obstacle of the pile-up. The metric is
+ *
+ *   peak           the largest value of the field
+ *   peak_distance  the distance of the peak from the plane
+ *   extent         the largest distance at which the field exceeds the threshold, given as a
+ *                  fraction of the peak (layer thickness, pile-up length) or as a value
+ *                  (plastic zone size)
+ *
+ * Equal peaks are resolved to the one closest to the plane. An absolute threshold is applied
+ * point by point. A fraction of the peak is only known once all elements are visited, so
+ * every element keeps its largest field value and largest distance, and the extent is
+ * resolved to the element size.
+ */
+class DislocationLayerMetric : public ElementPostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  DislocationLayerMetric(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override;
+  virtual PostprocessorValue getValue() const override;
+
+protected:
+  /// Field at the current quadrature point
+  Real field() const;
+
+  /// Takes value as the peak if it is larger, or equal and closer to the plane
+  void updatePeak(const Real value, const Real distance);
+
+  const enum class Metric { PEAK, PEAK_DISTANCE, EXTENT } _metric;
+
+  /// GND (difference) or sum of the coupled variables
+  const enum class Measure { GND, SUM } _measure;
+
+  const Real _initial_total_dislo_den;
+
+  ///@{Reference plane the distances are measured from
+  const Point _reference_point;
+  RealVectorValue _direction;
+  ///@}
+
+  /// Threshold of the extent, relative to the peak or absolute
+  const enum class ThresholdType { FRACTION_OF_PEAK, ABSOLUTE } _threshold_type;
+  const Real _threshold;
+
+  std::vector<const VariableValue *> _positive;
+  std::vector<const VariableValue *> _negative;
+
+  ///@{Largest field value and its distance
+  Real _peak;
+  Real _peak_distance;
+  ///@}
+
+  /// Largest distance and field value of every local element, only kept for the extent
+  /// relative to the peak
+  std::vector<std::pair<Real, Real>> _element_samples;
+
+  Real _value;
+};
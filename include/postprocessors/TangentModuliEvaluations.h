@@ -0,0 +1,33 @@
+//* This file is for continuum dislocation density field-based theory
+//* Zhangchen Fan
+//* Harbin Institute of Technology, Shenzhen
+//* Centre for Micro-mechanics Modelling and Characterisation
+//* 19 Oct 2026
+
+#pragma once
+
+#include "GeneralPostprocessor.h"
+
+/**
+ * TangentModuliEvaluations reports how many tangent moduli a
+ * ComputeCrystalPlasticityDislocationStress material has built since the start of the run,
+ * summed over the threads and processors, e.g. to check that residual evaluations and explicit
+ * solves skip them.
+ */
+class TangentModuliEvaluations : public GeneralPostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  TangentModuliEvaluations(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override;
+  virtual PostprocessorValue getValue() const override;
+
+protected:
+  const MaterialName & _stress_material;
+
+  Real _value;
+};
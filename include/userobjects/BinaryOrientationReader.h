@@ -0,0 +1,39 @@
+//* This file is for continuum dislocation density field-based theory
+//* Zhangchen Fan
+//* Harbin Institute of Technology, Shenzhen
+//* Centre for Micro-mechanics Modelling and Characterisation
+//* 19 Oct 2026
+
+#pragma once
+
+#include "GeneralUserObject.h"
+#include "OrientationMap.h"
+
+/**
+ * BinaryOrientationReader provides the Euler angles and the grain id of every element from a
+ * memory-mapped binary orientation file (see OrientationMap), keyed by the element id. Unlike
+ * a text file parsed on every rank, only the records of the local elements are ever read, so
+ * the startup time and memory do not grow with the number of elements and grains.
+ * The element ids are those of the unrefined mesh, after any renumbering mesh generator:
+ * elements created by mesh refinement take the orientation of their top parent.
+ */
+class BinaryOrientationReader : public GeneralUserObject
+{
+public:
+  static InputParameters validParams();
+
+  BinaryOrientationReader(const InputParameters & parameters);
+
+  /// Bunge Euler angles in degrees of the element
+  RealVectorValue getEulerAngles(const Elem * elem) const;
+
+  /// Grain id of the element
+  unsigned int getGrainID(const Elem * elem) const;
+
+  virtual void initialize() override {}
+  virtual void execute() override {}
+  virtual void finalize() override {}
+
+protected:
+  OrientationMap _orientations;
+};
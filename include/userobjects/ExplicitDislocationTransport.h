@@ -0,0 +1,120 @@
+//* This file is for continuum dislocation density field-based theory
+//* Zhangchen Fan
+//* Harbin Institute of Technology, Shenzhen
+//* Centre for Micro-mechanics Modelling and Characterisation
+//* 19 Oct 2026
+
+#pragma once
+
+#include "ElementUserObject.h"
+
+#include <unordered_set>
+
+/**
+ * ExplicitDislocationTransport advances the signed dislocation densities explicitly after the
+ * mechanics of a time step has converged, which turns the coupled problem into an
+ * implicit-explicit (IMEX) splitting: the global Newton system only holds the displacements,
+ * while the densities live in first order LAGRANGE auxiliary variables read by the crystal
+ * plasticity model. The transport operator is the mass-lumped full-upwind scheme of
+ * ConservativeAdvectionSchmid. Each element only contributes its nodal outflow coefficients
+ * -int grad(phi_i) . v, computed with the converged dislocation velocity, so every stage of the
+ * SSP Runge-Kutta update is a matrix-free sweep over the elements. The time step is subdivided
+ * to keep the nodal Courant number below max_courant.
+ *
+ * Every rank only keeps the coefficients of its own elements and the densities at their nodes.
+ * The element sums at the nodes on the partition boundary (and at periodic node sets spanning
+ * several ranks) are completed by exchanging them with the ranks sharing these nodes, once for
+ * the lumped masses and outflows and once per Runge-Kutta stage, and are always added in rank
+ * order so that every rank holds the same nodal densities.
+ *
+ * Like the full-upwind ConservativeAdvectionSchmid, the update only transports the densities:
+ * the statistically stored dislocation (SSD) source of is_ssd_included is not applied here.
+ */
+class ExplicitDislocationTransport : public ElementUserObject
+{
+public:
+  static InputParameters validParams();
+
+  ExplicitDislocationTransport(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override;
+
+  /// Number of explicit substeps taken in the last time step
+  unsigned int numberSubsteps() const { return _number_substeps; }
+
+protected:
+  /// Nodal rate of change -M^{-1} R(u) of all densities
+  void transportRate(const std::vector<Real> & u, std::vector<Real> & rate) const;
+
+  /// Dislocation velocity of a density at a quadrature point
+  RealVectorValue velocity(const unsigned int density, const unsigned int qp) const;
+
+  /// Representative node of a periodic node set
+  dof_id_type representativeNode(const dof_id_type node_id) const;
+
+  /// Finds the ranks sharing the local nodes whose element sums are incomplete on this rank
+  void findSharedNodes(const std::unordered_map<dof_id_type, std::size_t> & node_index);
+
+  /**
+   * Completes the values of the shared nodes, width values per local node: sums the
+   * contributions of all ranks sharing a node in rank order, or takes the value of the lowest
+   * of these ranks
+   */
+  void exchangeSharedNodes(std::vector<Real> & values,
+                           const unsigned int width,
+                           const bool sum) const;
+
+  /// Transported densities and their nodal values
+  const unsigned int _number_densities;
+  std::vector<MooseVariable *> _density_vars;
+  std::vector<const VariableValue *> _density_nodal;
+
+  ///@{ Slip system, sign and character of every density
+  std::vector<unsigned int> _slip_sys_index;
+  std::vector<Real> _dislo_sign;
+  std::vector<bool> _is_edge;
+  ///@}
+
+  /// Runge-Kutta scheme of the transport update
+  const enum class Scheme { FORWARD_EULER, SSP_RK2, SSP_RK3 } _scheme;
+
+  /// Largest nodal Courant number of a substep
+  const Real _max_courant;
+
+  ///@{ Slip directions and signed velocity magnitudes of all slip systems
+  const MaterialProperty<std::vector<Real>> & _edge_slip_direction;
+  const MaterialProperty<std::vector<Real>> & _screw_slip_direction;
+  const MaterialProperty<std::vector<Real>> & _dislo_velocity;
+  ///@}
+
+  /**
+   * Per element, the number of nodes and the node ids, and the lumped mass and the outflow
+   * coefficient of every density at every node
+   */
+  std::vector<dof_id_type> _element_nodes;
+  std::vector<Real> _element_coefficients;
+
+  /// Per node, the node id and the dof index of every density, and the nodal densities
+  std::vector<dof_id_type> _node_dofs;
+  std::vector<Real> _node_values;
+
+  /// Periodic node sets, mapped to their smallest node id
+  std::unordered_map<dof_id_type, dof_id_type> _periodic_representative;
+
+  /// Representative nodes of all periodic node sets
+  std::unordered_set<dof_id_type> _periodic_sets;
+
+  /// Local nodal indices shared with every other rank, in the order of their node ids
+  std::map<processor_id_type, std::vector<std::size_t>> _shared_nodes;
+
+  unsigned int _number_substeps;
+
+  ///@{ Local nodal index of every element node entry, and lumped mass of every local node
+  std::vector<std::size_t> _element_index;
+  std::vector<Real> _lumped_mass;
+  ///@}
+};
@@ -0,0 +1,66 @@
+//* This file is for continuum dislocation density field-based theory
+//* Zhangchen Fan
+//* Harbin Institute of Technology, Shenzhen
+//* Centre for Micro-mechanics Modelling and Characterisation
+//* 19 Oct 2026
+
+#pragma once
+
+#include "GeneralUserObject.h"
+
+/**
+ * SlipSystemRegistry reads a slip system file once per process and shares the normalised slip
+ * plane normals and slip directions (after the unit cell scaling and, for HCP, the
+ * Miller-Bravais transformation) with every object that asks for them. The cache is static,
+ * so crystal plasticity models on all blocks and threads parse each file only once even without
+ * a registry object. Adding the registry to the input additionally lets the models and other
+ * objects, e.g. transport kernels, share one slip system definition by name.
+ */
+class SlipSystemRegistry : public GeneralUserObject
+{
+public:
+  static InputParameters validParams();
+
+  SlipSystemRegistry(const InputParameters & parameters);
+
+  enum class LatticeType
+  {
+    BCC,
+    FCC,
+    HCP
+  };
+
+  /// Slip plane normals and slip directions, both normalised, in the lattice frame
+  struct Geometry
+  {
+    std::vector<RealVectorValue> plane_normals;
+    std::vector<RealVectorValue> directions;
+  };
+
+  /**
+   * Returns the slip systems of the file, parsing it on the first request for this file,
+   * lattice and unit cell. Thread safe.
+   */
+  static std::shared_ptr<const Geometry> geometry(const std::string & file_name,
+                                                  const LatticeType lattice,
+                                                  const std::vector<Real> & unit_cell_dimension,
+                                                  const Real zero_tol);
+
+  /// Slip systems of this registry
+  const Geometry & slipSystems() const { return *_geometry; }
+  unsigned int numberSlipSystems() const { return _geometry->directions.size(); }
+
+  virtual void initialize() override {}
+  virtual void execute() override {}
+  virtual void finalize() override {}
+
+protected:
+  const std::shared_ptr<const Geometry> _geometry;
+
+private:
+  /// Parses and normalises the slip systems of a file
+  static Geometry read(const std::string & file_name,
+                       const LatticeType lattice,
+                       const std::vector<Real> & unit_cell_dimension,
+                       const Real zero_tol);
+};
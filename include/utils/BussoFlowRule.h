@@ -0,0 +1,148 @@
+//* This file is for continuum dislocation density field-based theory
+//* Zhangchen Fan
+//* Harbin Institute of Technology, Shenzhen
+//* Centre for Micro-mechanics Modelling and Characterisation
+//* 19 Oct 2026
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <cmath>
+
+/**
+ * Point-wise pieces of Busso's thermally activated flow rule, shared by the
+ * CrystalPlasticityBussoUpdate* materials and the stand-alone calibration driver
+ * so that both integrate exactly the same constitutive law.
+ */
+namespace BussoFlowRule
+{
+/// Constants of the flow rule for one material parameter set
+struct Parameters
+{
+  Real gdot0;
+  Real f0;
+  Real boltzmann;
+  /// absolute temperature in Kelvin
+  Real theta;
+  Real p;
+  Real q;
+  Real tau_0;
+};
+
+/**
+ * Taylor-type slip resistance from the hardening dislocation density,
+ * tau_c = lambda * mu * b * sqrt(rho_hardening)
+ */
+inline Real
+slipResistance(const Real dlamb,
+               const Real shear_modulus,
+               const Real burgers,
+               const Real hardening_dislocation_density)
+{
+  return dlamb * shear_modulus * burgers * std::sqrt(hardening_dislocation_density);
+}
+
+/**
+ * Slip rate for the effective resolved shear stress tau_eff = tau - backstress.
+ * Returns zero below the slip resistance (driving force smaller than zero_tol).
+ */
+inline Real
+slipRate(const Real tau_eff, const Real slip_resistance, const Parameters & params, const Real zero_tol)
+{
+  const Real driving_force = std::abs(tau_eff) - slip_resistance;
+  if (driving_force < zero_tol)
+    return 0.0;
+
+  return params.gdot0 *
+         std::exp(-params.f0 / params.boltzmann / params.theta *
+                  std::pow((1.0 - std::pow((driving_force / params.tau_0), params.p)), params.q)) *
+         std::copysign(1.0, tau_eff);
+}
+
+/**
+ * Exact derivative of slipRate with respect to the effective resolved shear stress.
+ */
+inline Real
+slipRateDerivative(const Real tau_eff,
+                   const Real slip_resistance,
+                   const Parameters & params,
+                   const Real zero_tol)
+{
+  const Real driving_force = std::abs(tau_eff) - slip_resistance;
+  if (driving_force < zero_tol)
+    return 0.0;
+
+  const Real u = driving_force / params.tau_0;
+  const Real activation = params.f0 / params.boltzmann / params.theta;
+  const Real v = 1.0 - std::pow(u, params.p);
+
+  return params.gdot0 * activation * params.p * params.q / params.tau_0 *
+         std::exp(-activation * std::pow(v, params.q)) * std::pow(u, params.p - 1.0) *
+         std::pow(v, params.q - 1.0);
+}
+
+/**
+ * slipRate and slipRateDerivative of n independent entries, e.g. all slip systems of all
+ * quadrature points of an element stored in structure-of-arrays layout. The branch of the
+ * scalar functions is replaced by a select so that the loop over the entries vectorizes.
+ */
+inline void
+slipRates(const std::size_t n,
+          const Real * tau_eff,
+          const Real * slip_resistance,
+          const Parameters & params,
+          const Real zero_tol,
+          Real * slip_rate,
+          Real * dslip_dtau)
+{
+  const Real activation = params.f0 / params.boltzmann / params.theta;
+  const Real derivative_factor = params.gdot0 * activation * params.p * params.q / params.tau_0;
+
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    const Real driving_force = std::abs(tau_eff[i]) - slip_resistance[i];
+    const bool active = driving_force >= zero_tol;
+    // Inactive entries are evaluated at a harmless point and discarded
+    const Real u = active ? driving_force / params.tau_0 : 0.5;
+    const Real v = 1.0 - std::pow(u, params.p);
+    const Real exponential = std::exp(-activation * std::pow(v, params.q));
+
+    slip_rate[i] = active ? std::copysign(params.gdot0 * exponential, tau_eff[i]) : 0.0;
+    dslip_dtau[i] = active ? derivative_factor * exponential * std::pow(u, params.p - 1.0) *
+                                 std::pow(v, params.q - 1.0)
+                           : 0.0;
+  }
+}
+
+/**
+ * Component-wise inverse of a (rotated) slip direction stored as LIBMESH_DIM
+ * contiguous entries. Components below 1e-10 do not contribute to the backstress.
+ */
+inline RealVectorValue
+inverseSlipDirection(const Real * direction)
+{
+  RealVectorValue inverse;
+  for (unsigned int j = 0; j < LIBMESH_DIM; ++j)
+    inverse(j) = direction[j] < 1.e-10 ? 0.0 : 1.0 / direction[j];
+  return inverse;
+}
+
+/**
+ * Long-range backstress from the gradients of the signed (GND) edge and screw
+ * densities of one slip system, normalised by its total density.
+ */
+inline Real
+backstress(const RealVectorValue & grad_edge_gnd,
+           const RealVectorValue & grad_screw_gnd,
+           const RealVectorValue & inverse_edge_direction,
+           const RealVectorValue & inverse_screw_direction,
+           const Real total_dislocation_density,
+           const Real burgers,
+           const Real shear_modulus)
+{
+  return burgers * shear_modulus *
+         (grad_edge_gnd * inverse_edge_direction + grad_screw_gnd * inverse_screw_direction) /
+         total_dislocation_density;
+}
+}
@@ -0,0 +1,235 @@
+//* This file is for continuum dislocation density field-based theory
+//* Zhangchen Fan
+//* Harbin Institute of Technology, Shenzhen
+//* Centre for Micro-mechanics Modelling and Characterisation
+//* 19 Oct 2026
+
+#pragma once
+
+#include "BussoFlowRule.h"
+#include "SlipInteractionMatrix.h"
+
+#include <array>
+#include <memory>
+
+/**
+ * Per-qp slip system update of the Busso models (slip resistance, backstress and slip rate of
+ * all slip systems). The implementations are instantiated for fixed slip system counts and
+ * spatial dimensions, so that the per slip system loops have compile-time trip counts and
+ * work on std::array buffers sized by the slip system count. BussoSlipKernelBase::build picks
+ * the instantiation once per material; the model fills the input buffers of a quadrature point
+ * and runs its whole slip system update with a single call.
+ */
+class BussoSlipKernelBase
+{
+public:
+  /// Coupling of the backstresses of the two slip systems of the multi-slip BLP
+  /// (Yefimov and Van der Giessen 2005)
+  enum class Interaction
+  {
+    NONE,
+    V1,
+    V2,
+    V3
+  };
+
+  virtual ~BussoSlipKernelBase() = default;
+
+  /// The buffer pointers refer to the instantiation's own arrays
+  BussoSlipKernelBase(const BussoSlipKernelBase &) = delete;
+  BussoSlipKernelBase & operator=(const BussoSlipKernelBase &) = delete;
+
+  /**
+   * Builds the kernel for the given slip system count (2, 12, 24 or 48) and spatial
+   * dimension (2 or 3). The interaction variants are only available with 2 slip systems.
+   */
+  static std::unique_ptr<BussoSlipKernelBase> build(const unsigned int number_slip_systems,
+                                                    const unsigned int dim,
+                                                    const Interaction interaction);
+
+  unsigned int numberSlipSystems() const { return _number_slip_systems; }
+
+  ///@{Per slip system inputs, filled by the model before the update of a quadrature point.
+  /// The screw GND gradients and directions stay zero for models with edge dislocations only.
+  Real * totalDensity() const { return _total_density; }
+  RealVectorValue * gradEdgeGND() const { return _grad_edge_gnd; }
+  RealVectorValue * gradScrewGND() const { return _grad_screw_gnd; }
+  RealVectorValue * inverseEdgeDirection() const { return _inverse_edge_direction; }
+  RealVectorValue * inverseScrewDirection() const { return _inverse_screw_direction; }
+  ///@}
+
+  /**
+   * Taylor-type slip resistance of the total densities through the latent hardening matrix,
+   * tau_c_i = taylor_factor * sqrt(sum_j h_ij rho_j)
+   * @param taylor_factor lambda * mu * b
+   */
+  virtual void slipResistance(const SlipInteractionMatrix & latent_hardening,
+                              const Real taylor_factor,
+                              Real * slip_resistance) const = 0;
+
+  /**
+   * Long-range backstress of every slip system (see BussoFlowRule::backstress), including
+   * the interaction between the slip systems
+   * @param scale prefactor of the backstress, e.g. mu * b
+   */
+  virtual void backstress(const Real scale, Real * backstress) const = 0;
+
+  /**
+   * Slip resistance, backstress and slip rate of all slip systems for the effective resolved
+   * shear stress tau - backstress
+   */
+  virtual void update(const Real * tau,
+                      const SlipInteractionMatrix & latent_hardening,
+                      const Real taylor_factor,
+                      const Real backstress_scale,
+                      const BussoFlowRule::Parameters & params,
+                      const Real zero_tol,
+                      Real * slip_resistance,
+                      Real * backstress,
+                      Real * slip_rate) const = 0;
+
+protected:
+  BussoSlipKernelBase(const unsigned int number_slip_systems,
+                      Real * total_density,
+                      RealVectorValue * grad_edge_gnd,
+                      RealVectorValue * grad_screw_gnd,
+                      RealVectorValue * inverse_edge_direction,
+                      RealVectorValue * inverse_screw_direction)
+    : _number_slip_systems(number_slip_systems),
+      _total_density(total_density),
+      _grad_edge_gnd(grad_edge_gnd),
+      _grad_screw_gnd(grad_screw_gnd),
+      _inverse_edge_direction(inverse_edge_direction),
+      _inverse_screw_direction(inverse_screw_direction)
+  {
+  }
+
+private:
+  const unsigned int _number_slip_systems;
+
+  ///@{Buffers of the instantiation
+  Real * const _total_density;
+  RealVectorValue * const _grad_edge_gnd;
+  RealVectorValue * const _grad_screw_gnd;
+  RealVectorValue * const _inverse_edge_direction;
+  RealVectorValue * const _inverse_screw_direction;
+  ///@}
+};
+
+template <unsigned int N, unsigned int dim, BussoSlipKernelBase::Interaction interaction>
+class BussoSlipKernel final : public BussoSlipKernelBase
+{
+  static_assert(dim == 2 || dim == 3, "Busso slip kernels are implemented for 2D and 3D");
+  static_assert(interaction == Interaction::NONE || N == 2,
+                "Backstress interaction is only defined for two slip systems");
+
+public:
+  BussoSlipKernel()
+    : BussoSlipKernelBase(N,
+                          _total_density.data(),
+                          _grad_edge_gnd.data(),
+                          _grad_screw_gnd.data(),
+                          _inverse_edge_direction.data(),
+                          _inverse_screw_direction.data())
+  {
+  }
+
+  virtual void slipResistance(const SlipInteractionMatrix & latent_hardening,
+                              const Real taylor_factor,
+                              Real * slip_resistance) const override
+  {
+    // The uniform case needs no matrix,
+    // sum_j h_ij rho_j = latent sum_j rho_j + (self - latent) rho_i
+    if (latent_hardening.isUniform())
+    {
+      const Real self = latent_hardening.selfCoefficient();
+      const Real latent = latent_hardening.latentCoefficient();
+
+      Real sum_density = 0.0;
+      for (unsigned int j = 0; j < N; ++j)
+        sum_density += _total_density[j];
+
+      for (unsigned int i = 0; i < N; ++i)
+        slip_resistance[i] =
+            taylor_factor * std::sqrt(latent * sum_density + (self - latent) * _total_density[i]);
+    }
+    else
+    {
+      const Real * interaction_matrix = latent_hardening.data();
+      for (unsigned int i = 0; i < N; ++i)
+      {
+        Real hardening_density = 0.0;
+        for (unsigned int j = 0; j < N; ++j)
+          hardening_density += interaction_matrix[i * N + j] * _total_density[j];
+        slip_resistance[i] = taylor_factor * std::sqrt(hardening_density);
+      }
+    }
+  }
+
+  virtual void backstress(const Real scale, Real * backstress) const override
+  {
+    std::array<Real, N> self;
+    for (unsigned int i = 0; i < N; ++i)
+    {
+      Real projected_gradient = 0.0;
+      for (unsigned int d = 0; d < dim; ++d)
+        projected_gradient += _grad_edge_gnd[i](d) * _inverse_edge_direction[i](d);
+      for (unsigned int d = 0; d < dim; ++d)
+        projected_gradient += _grad_screw_gnd[i](d) * _inverse_screw_direction[i](d);
+
+      self[i] = scale * projected_gradient / _total_density[i];
+    }
+
+    if constexpr (interaction == Interaction::NONE)
+      for (unsigned int i = 0; i < N; ++i)
+        backstress[i] = self[i];
+    else
+    {
+      backstress[0] = self[0] + coupling() * self[1];
+      backstress[1] = coupling() * self[0] + self[1];
+    }
+  }
+
+  virtual void update(const Real * tau,
+                      const SlipInteractionMatrix & latent_hardening,
+                      const Real taylor_factor,
+                      const Real backstress_scale,
+                      const BussoFlowRule::Parameters & params,
+                      const Real zero_tol,
+                      Real * slip_resistance,
+                      Real * backstress,
+                      Real * slip_rate) const override
+  {
+    BussoSlipKernel::slipResistance(latent_hardening, taylor_factor, slip_resistance);
+    BussoSlipKernel::backstress(backstress_scale, backstress);
+
+    for (unsigned int i = 0; i < N; ++i)
+      slip_rate[i] =
+          BussoFlowRule::slipRate(tau[i] - backstress[i], slip_resistance[i], params, zero_tol);
+  }
+
+private:
+  /// Off-diagonal entry of the backstress interaction matrix
+  static constexpr Real coupling()
+  {
+    switch (interaction)
+    {
+      case Interaction::V1:
+        return 0.267;
+      case Interaction::V2:
+        return -0.466;
+      case Interaction::V3:
+        return 0.5;
+      default:
+        return 0.0;
+    }
+  }
+
+  ///@{Per slip system inputs
+  std::array<Real, N> _total_density{};
+  std::array<RealVectorValue, N> _grad_edge_gnd;
+  std::array<RealVectorValue, N> _grad_screw_gnd;
+  std::array<RealVectorValue, N> _inverse_edge_direction;
+  std::array<RealVectorValue, N> _inverse_screw_direction;
+  ///@}
+};
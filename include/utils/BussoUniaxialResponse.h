@@ -0,0 +1,94 @@
+//* This file is for continuum dislocation density field-based theory
+//* Zhangchen Fan
+//* Harbin Institute of Technology, Shenzhen
+//* Centre for Micro-mechanics Modelling and Characterisation
+//* 19 Oct 2026
+
+#pragma once
+
+#include "BussoFlowRule.h"
+#include "SlipInteractionMatrix.h"
+
+#include <vector>
+
+class BussoSlipKernelBase;
+
+/**
+ * Homogeneous single crystal under uniaxial stress along a fixed lattice direction, integrated
+ * with the per-qp slip system update of the Busso materials (BussoSlipKernel): the slip
+ * resistance of every slip system goes through the latent hardening matrix and the slip rates
+ * are those of the Busso flow rule for the resolved shear stresses sigma * m_i, with the signed
+ * Schmid factors m_i = (l . n_i)(l . d_i). The dislocation densities are uniform and do not
+ * evolve, and the backstress vanishes since there are no GND gradients.
+ */
+class BussoUniaxialResponse
+{
+public:
+  /// Local solver controls, with the meaning of the crystal plasticity material parameters
+  struct Controls
+  {
+    Real rtol;
+    unsigned int maxiter;
+    unsigned int max_substep_iter;
+    Real slip_incr_tol;
+    Real zero_tol;
+  };
+
+  /**
+   * @param plane_normals normalised slip plane normals in the lattice frame
+   * @param directions normalised slip directions in the lattice frame
+   * @param loading_direction loading direction in the lattice frame, need not be normalised
+   * @param latent_hardening interaction matrix of the slip systems
+   */
+  BussoUniaxialResponse(const std::vector<RealVectorValue> & plane_normals,
+                        const std::vector<RealVectorValue> & directions,
+                        const RealVectorValue & loading_direction,
+                        const SlipInteractionMatrix & latent_hardening,
+                        const Real youngs_modulus,
+                        const Real shear_modulus,
+                        const Real burgers,
+                        const Real dislocation_density,
+                        const Controls & controls);
+
+  /**
+   * Axial stress over a strain history applied at a constant strain rate, starting from
+   * stress[0]. Each strain increment is halved until it integrates. Only reads immutable
+   * members and is therefore safe to call concurrently.
+   * @param stress resized to the length of the history
+   * @return false if an increment could not be integrated
+   */
+  bool integrate(const BussoFlowRule::Parameters & flow_rule,
+                 const Real dlamb,
+                 const std::vector<Real> & strain,
+                 const Real strain_rate,
+                 std::vector<Real> & stress) const;
+
+  const std::vector<Real> & schmidFactors() const { return _schmid_factors; }
+
+protected:
+  /**
+   * Backward Euler update of the axial stress over one strain increment, with a safeguarded
+   * Newton iteration on the stress. Returns false if the increment has to be cut.
+   * @param slip_resistance slip resistance of every slip system
+   * @param work scratch space of four values per slip system
+   */
+  bool integrateIncrement(const BussoSlipKernelBase & kernel,
+                          const BussoFlowRule::Parameters & flow_rule,
+                          const Real taylor_factor,
+                          const std::vector<Real> & slip_resistance,
+                          std::vector<Real> & work,
+                          const Real stress_old,
+                          const Real strain_increment,
+                          const Real dt,
+                          Real & stress) const;
+
+  /// Signed Schmid factor of every slip system
+  std::vector<Real> _schmid_factors;
+
+  const SlipInteractionMatrix _latent_hardening;
+  const Real _youngs_modulus;
+  const Real _shear_modulus;
+  const Real _burgers;
+  const Real _dislocation_density;
+  const Controls _controls;
+};
@@ -0,0 +1,66 @@
+//* This file is for continuum dislocation density field-based theory
+//* Zhangchen Fan
+//* Harbin Institute of Technology, Shenzhen
+//* Centre for Micro-mechanics Modelling and Characterisation
+//* 19 Oct 2026
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <cstdint>
+#include <string>
+
+/**
+ * Read-only, memory-mapped view of a binary per-element orientation file, written by
+ * scripts/convert_orientations.py. The file holds a 32 byte header
+ *
+ *   char     magic[8]         "CDFORI01"
+ *   uint64_t number_elements
+ *   uint32_t record_size      32
+ *   uint32_t reserved
+ *   uint64_t reserved
+ *
+ * followed by one 32 byte record per element id, in element id order
+ *
+ *   double   euler_angles[3]  Bunge Euler angles in degrees
+ *   uint32_t grain_id
+ *   uint32_t padding
+ *
+ * in little endian byte order. The file is mapped, not read, so every rank only touches the
+ * pages of its own elements and the ranks on a node share the page cache: the memory and the
+ * startup cost do not grow with the number of elements or grains.
+ */
+class OrientationMap
+{
+public:
+  OrientationMap() = default;
+  ~OrientationMap();
+
+  OrientationMap(const OrientationMap &) = delete;
+  OrientationMap & operator=(const OrientationMap &) = delete;
+
+  /// Maps the file and checks its header
+  void open(const std::string & file_name);
+
+  /// Number of element records in the file
+  std::uint64_t numberElements() const { return _number_elements; }
+
+  /// Bunge Euler angles (phi1, Phi, phi2) in degrees of an element
+  RealVectorValue eulerAngles(const std::uint64_t element_id) const;
+
+  /// Grain the element belongs to
+  std::uint32_t grainID(const std::uint64_t element_id) const;
+
+  static constexpr std::size_t header_size = 32;
+  static constexpr std::size_t record_size = 32;
+
+private:
+  /// Start of the record of an element, with a bounds check
+  const unsigned char * record(const std::uint64_t element_id) const;
+
+  std::string _file_name;
+  const unsigned char * _data = nullptr;
+  std::size_t _size = 0;
+  std::uint64_t _number_elements = 0;
+};
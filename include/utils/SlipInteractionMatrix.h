@@ -0,0 +1,81 @@
+//* This file is for continuum dislocation density field-based theory
+//* Zhangchen Fan
+//* Harbin Institute of Technology, Shenzhen
+//* Centre for Micro-mechanics Modelling and Characterisation
+//* 19 Oct 2026
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <vector>
+
+/**
+ * Dense latent hardening (slip system interaction) matrix h_ij, stored row-major and
+ * assembled once per material from the geometric classification of each slip system pair.
+ * The hardening density of slip system i is then the mat-vec sum_j h_ij rho_j.
+ */
+class SlipInteractionMatrix
+{
+public:
+  /// Geometric relation between two slip systems
+  enum class InteractionType
+  {
+    SELF,
+    COPLANAR,  ///< same slip plane
+    COLLINEAR, ///< same slip direction (cross slip partners)
+    JUNCTION   ///< neither, the systems form forest junctions
+  };
+
+  /// Interaction coefficient of each interaction type
+  struct Coefficients
+  {
+    Real self;
+    Real coplanar;
+    Real collinear;
+    Real junction;
+  };
+
+  /**
+   * Row-major classification of all slip system pairs. Systems sharing a cross slip family
+   * are collinear; without families (empty cross_slip_families) the slip directions are
+   * compared instead. Coplanar takes precedence over collinear.
+   */
+  static std::vector<InteractionType>
+  classify(const std::vector<RealVectorValue> & plane_normals,
+           const std::vector<RealVectorValue> & directions,
+           const std::vector<std::vector<unsigned int>> & cross_slip_families);
+
+  /// Assembles the matrix of the given (row-major, size^2) classification
+  void build(const std::vector<InteractionType> & types,
+             const unsigned int size,
+             const Coefficients & coefficients);
+
+  unsigned int size() const { return _size; }
+
+  /// True if all latent coefficients are equal, so h_ij = latent + (self - latent) delta_ij
+  bool isUniform() const { return _uniform; }
+
+  ///@{ Diagonal and, if isUniform(), off-diagonal coefficient
+  Real selfCoefficient() const { return _self; }
+  Real latentCoefficient() const { return _latent; }
+  ///@}
+
+  Real operator()(const unsigned int i, const unsigned int j) const
+  {
+    return _values[i * _size + j];
+  }
+
+  /// Row-major coefficients
+  const Real * data() const { return _values.data(); }
+
+  /// y = h x for vectors of length size()
+  void multiply(const Real * x, Real * y) const;
+
+private:
+  unsigned int _size = 0;
+  bool _uniform = true;
+  Real _self = 0.0;
+  Real _latent = 0.0;
+  std::vector<Real> _values;
+};
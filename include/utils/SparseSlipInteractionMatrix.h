@@ -0,0 +1,48 @@
+//* This file is for continuum dislocation density field-based theory
+//* Zhangchen Fan
+//* Harbin Institute of Technology, Shenzhen
+//* Centre for Micro-mechanics Modelling and Characterisation
+//* 19 Oct 2026
+
+#pragma once
+
+#include "SlipInteractionMatrix.h"
+
+#include <cstdint>
+
+/**
+ * Slip system interaction matrix in compressed sparse row (CSR) storage for couplings where
+ * many interactions vanish, e.g. the backstress coupling of lattices with many slip systems
+ * (BCC 48, HCP with several families), which only couples a few types of pairs. Zero
+ * coefficients are not stored, and every stored entry only keeps the index of its interaction
+ * type, so the coefficients themselves are shared. A mat-vec costs O(nonZeros()) instead of
+ * O(size()^2).
+ */
+class SparseSlipInteractionMatrix
+{
+public:
+  /// Assembles the matrix of the given (row-major, size^2) classification
+  void build(const std::vector<SlipInteractionMatrix::InteractionType> & types,
+             const unsigned int size,
+             const SlipInteractionMatrix::Coefficients & coefficients);
+
+  unsigned int size() const { return _size; }
+
+  /// Number of stored (nonzero) interactions
+  std::size_t nonZeros() const { return _columns.size(); }
+
+  /// y = h x for vectors of length size()
+  void multiply(const Real * x, Real * y) const;
+
+private:
+  unsigned int _size = 0;
+
+  /// Coefficient of each interaction type, indexed by the InteractionType value
+  Real _coefficients[4] = {};
+
+  ///@{CSR pattern: entries of row i are [_row_offsets[i], _row_offsets[i + 1])
+  std::vector<std::size_t> _row_offsets;
+  std::vector<unsigned int> _columns;
+  std::vector<std::uint8_t> _types;
+  ///@}
+};
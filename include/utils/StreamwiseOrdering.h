@@ -0,0 +1,33 @@
+//* This file is for continuum dislocation density field-based theory
+//* Zhangchen Fan
+//* Harbin Institute of Technology, Shenzhen
+//* Centre for Micro-mechanics Modelling and Characterisation
+//* 19 Oct 2026
+
+#pragma once
+
+#include "MooseEnum.h"
+
+#include "libmesh/mesh_base.h"
+
+/**
+ * Helpers shared by StripPartitioner and StreamwiseRenumberGenerator to order the
+ * elements and nodes of quasi-1D meshes along their principal (streamwise) axis.
+ */
+namespace StreamwiseOrdering
+{
+/// Axis selection: auto, x, y or z
+MooseEnum axisEnum();
+
+/// Returns the requested axis, or the direction of the longest bounding box extent for auto
+unsigned int resolveAxis(const MeshBase & mesh, const MooseEnum & axis);
+
+/**
+ * Active elements sorted by their vertex average along the axis; ties are broken by the
+ * remaining coordinates and finally by element id so the order is deterministic.
+ */
+std::vector<Elem *> sortedActiveElements(MeshBase & mesh, const unsigned int axis);
+
+/// Nodes sorted along the axis with the same tie-breaking rule
+std::vector<Node *> sortedNodes(MeshBase & mesh, const unsigned int axis);
+}
@@ -0,0 +1,77 @@
+//* This file is for continuum dislocation density field-based theory
+//* Zhangchen Fan
+//* Harbin Institute of Technology, Shenzhen
+//* Centre for Micro-mechanics Modelling and Characterisation
+//* 19 Oct 2026
+
+#pragma once
+
+#include "GeneralVectorPostprocessor.h"
+#include "BussoUniaxialResponse.h"
+
+#include <memory>
+
+/**
+ * BussoCalibrationBatch evaluates many Busso flow-rule parameter sets against one
+ * experimental stress-strain curve in a single run. Every parameter set is an
+ * independent homogeneous single-crystal integration under a constant strain rate,
+ * through the slip system update of the Busso materials (see BussoUniaxialResponse),
+ * so the sets are distributed over the MPI ranks and then over the threads of each
+ * rank (a work-stealing pool when libMesh is built with TBB). The objective value
+ * (mean squared stress error) of every set is returned as a vector so that an
+ * optimiser or a post-processing script can pick it up from the CSV output.
+ */
+class BussoCalibrationBatch : public GeneralVectorPostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  BussoCalibrationBatch(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+
+  /// Flow-rule and hardening constants of one calibration candidate
+  struct CaseParameters
+  {
+    BussoFlowRule::Parameters flow_rule;
+    Real dlamb;
+  };
+
+  /**
+   * Integrates the single-crystal response of one candidate over the experimental
+   * strain history and returns the mean squared stress error. The method only reads
+   * immutable members and is therefore safe to call concurrently.
+   * @param params the candidate parameter set
+   * @param converged set to false if any increment could not be integrated
+   */
+  Real evaluateObjective(const CaseParameters & params, bool & converged) const;
+
+protected:
+  /// Names of the calibrated parameters, in the column order of the output
+  static const std::vector<std::string> _calibrated_names;
+
+  /// Default values of the calibrated parameters when a column is absent from the file
+  std::vector<Real> _default_values;
+
+  /// Parameter sets read from file, one vector per calibrated parameter
+  std::vector<std::vector<Real>> _parameter_sets;
+
+  /// Experimental strain and stress
+  std::vector<Real> _experimental_strain;
+  std::vector<Real> _experimental_stress;
+
+  /// Fixed loading and material constants
+  const Real _strain_rate;
+  const Real _temperature;
+  const Real _boltzmann;
+
+  /// Single crystal response shared by all candidates
+  std::unique_ptr<const BussoUniaxialResponse> _response;
+
+  /// Output vectors
+  std::vector<VectorPostprocessorValue *> _parameter_vectors;
+  VectorPostprocessorValue & _objective;
+  VectorPostprocessorValue & _converged;
+};
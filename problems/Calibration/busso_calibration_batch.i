@@ -0,0 +1,43 @@
+# Batch evaluation of Busso flow-rule parameter sets against an experimental
+# stress-strain curve. No finite element solve is performed: every row of
+# busso_parameter_sets.csv is integrated as a homogeneous FCC single crystal
+# loaded along [001], through the slip system update of the Busso materials,
+# and the mean squared stress error is written to the CSV output.
+# Run with e.g. --n-threads=8 (and/or mpiexec) to spread the sets.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 1
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[VectorPostprocessors]
+  [calibration]
+    type = BussoCalibrationBatch
+    parameter_sets_file = busso_parameter_sets.csv
+    experimental_data_file = experimental_stress_strain.csv
+    strain_rate = 1.0e-3
+    youngs_modulus = 70000.0
+    loading_direction = '0 0 1'
+    slip_sys_file_name = input_slip_fcc_sys.txt
+    dislocation_density = 1.6e4
+    execute_on = initial
+  []
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  [csv]
+    type = CSV
+    file_base = busso_calibration_out
+    execute_on = final
+  []
+[]
@@ -457,6 +457,35 @@
     type = ElementAverageValue
     variable = epeq
   [../]
+  [peak_gnd]
+    type = DislocationLayerMetric
+    metric = peak
+    positive_densities = rho_edge_pos_1
+    negative_densities = rho_edge_neg_1
+    initial_total_dislo_den = 2.e6
+  []
+  [peak_gnd_distance]
+    type = DislocationLayerMetric
+    metric = peak_distance
+    positive_densities = rho_edge_pos_1
+    negative_densities = rho_edge_neg_1
+    initial_total_dislo_den = 2.e6
+  []
+  [layer_thickness]
+    type = DislocationLayerMetric
+    metric = extent
+    positive_densities = rho_edge_pos_1
+    negative_densities = rho_edge_neg_1
+    initial_total_dislo_den = 2.e6
+    threshold = 0.05
+  []
+  [plastic_zone]
+    type = DislocationLayerMetric
+    metric = extent
+    measure = sum
+    positive_densities = epeq
+    threshold = 0.5
+  []
 []
 
 [VectorPostprocessors]
@@ -479,11 +508,27 @@
 []
 
 [Outputs]
-  exodus = true
-  interval = 20
+  # The boundary layer metrics are recorded every step, a few full field frames suffice
+  [exodus]
+    type = Exodus
+    interval = 25000
+  []
   [csv]
     type = CSV
     file_base = dg_test_l400
     execute_on = final
   []
+  [metrics]
+    type = CSV
+    file_base = dg_test_l400_metrics
+    show = 'peak_gnd peak_gnd_distance layer_thickness plastic_zone'
+    execute_on = timestep_end
+  []
+  # Density profiles of the whole run in one file, read with scripts/read_line_samples.py
+  [line_samples]
+    type = BinaryLineSampleOutput
+    samplers = 'rhoep rhoen'
+    file_base = dg_test_l400_line_samples
+    interval = 100
+  []
 []
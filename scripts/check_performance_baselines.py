@@ -0,0 +1,111 @@
+#!/usr/bin/env python3
+"""
+Compare the performance postprocessors of a regression test against stored baselines.
+
+The test inputs write a '<name>_perf.csv' file with the columns wall_time,
+total_nonlinear_its, total_linear_its and peak_memory. The wall time and peak memory of a
+case are compared as ratios to the ones of test/tests/performance/perf_reference.i, a fixed
+workload run once on the same machine (--reference, its perf_reference_perf.csv), so that
+the baselines hold on any machine; the iteration counts are compared as they are. The
+baselines live in a JSON file next to the test, keyed by the case name:
+
+  {"dg_blp_reduced": {"wall_time_ratio": 3.1, "total_nonlinear_its": 31, ...}}
+
+A case without a stored baseline fails. Record or overwrite a baseline with --update, on
+a quiet machine, and commit it together with the change that caused it.
+"""
+
+import argparse
+import csv
+import json
+import os
+import sys
+
+# baseline entry -> (measured metric, compared to the reference run, command line option,
+#                    default allowed relative increase)
+METRICS = {
+    'wall_time_ratio': ('wall_time', True, 'time_tolerance', 0.5),
+    'total_nonlinear_its': ('total_nonlinear_its', False, 'iteration_tolerance', 0.1),
+    'total_linear_its': ('total_linear_its', False, 'iteration_tolerance', 0.1),
+    'peak_memory_ratio': ('peak_memory', True, 'memory_tolerance', 0.25),
+}
+
+
+def read_last_row(filename):
+    with open(filename, newline='') as f:
+        rows = list(csv.DictReader(f))
+    if not rows:
+        raise RuntimeError('{} contains no data'.format(filename))
+    return {key: float(value) for key, value in rows[-1].items()}
+
+
+def measure(results, reference):
+    """Baseline entries of a run, the ratios taken to the reference run"""
+    current = {}
+    for entry, (metric, relative, _, _) in METRICS.items():
+        if metric not in results:
+            continue
+        if not relative:
+            current[entry] = results[metric]
+        elif reference.get(metric, 0.0) > 0.0:
+            current[entry] = results[metric] / reference[metric]
+    return current
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--case', required=True, help='Name of the regression case')
+    parser.add_argument('--results', required=True, help='Performance CSV written by the test')
+    parser.add_argument('--reference', required=True,
+                        help='Performance CSV of the reference workload of the same session')
+    parser.add_argument('--baseline', required=True, help='JSON file holding the baselines')
+    parser.add_argument('--update', action='store_true', help='Record or overwrite the baseline')
+    for option, default in sorted(set((m[2], m[3]) for m in METRICS.values())):
+        parser.add_argument('--' + option.replace('_', '-'), dest=option, type=float,
+                            default=default,
+                            help='Allowed relative increase (default {})'.format(default))
+    args = parser.parse_args()
+
+    current = measure(read_last_row(args.results), read_last_row(args.reference))
+
+    baselines = {}
+    if os.path.exists(args.baseline):
+        with open(args.baseline) as f:
+            baselines = json.load(f)
+
+    if args.update:
+        baselines[args.case] = current
+        with open(args.baseline, 'w') as f:
+            json.dump(baselines, f, indent=2, sort_keys=True)
+            f.write('\n')
+        print('Recorded baseline for {}: {}'.format(args.case, current))
+        return 0
+
+    if args.case not in baselines:
+        print('No baseline for {} in {}, record one with --update'.format(args.case,
+                                                                        args.baseline))
+        return 1
+
+    failed = False
+    for entry, (_, _, option, _) in METRICS.items():
+        if entry not in baselines[args.case]:
+            continue
+        reference = baselines[args.case][entry]
+        limit = reference * (1.0 + getattr(args, option))
+        if entry not in current:
+            print('{:<22s} not measured (baseline {:.6g}) MISSING'.format(entry, reference))
+            failed = True
+            continue
+        value = current[entry]
+        status = 'OK'
+        if value > limit:
+            status = 'REGRESSION'
+            failed = True
+        print('{:<22s} {:>14.6g} (baseline {:.6g}, limit {:.6g}) {}'.format(
+            entry, value, reference, limit, status))
+
+    return 1 if failed else 0
+
+if __name__ == '__main__':
+    sys.exit(main())
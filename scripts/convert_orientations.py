@@ -0,0 +1,78 @@
+#!/usr/bin/env python3
+"""
+Convert per-element crystal orientations from text to the binary format read by
+BinaryOrientationReader (see include/utils/OrientationMap.h).
+
+Two text layouts are accepted, whitespace or comma separated, '#' starts a comment:
+
+  --euler FILE            one row per element, in element id order:
+                          phi1 Phi phi2 [grain_id]
+                          (the grain id defaults to the row number)
+
+  --grain-euler FILE      one row per grain, in grain id order: phi1 Phi phi2
+  --element-grains FILE   one grain id per element, in element id order
+
+Euler angles are Bunge angles in degrees, as for ComputeElasticityTensorCP.
+"""
+
+import argparse
+import struct
+import sys
+
+MAGIC = b'CDFORI01'
+HEADER = struct.Struct('<8sQIIQ')
+RECORD = struct.Struct('<3dII')
+
+
+def read_rows(filename):
+    with open(filename) as f:
+        for line in f:
+            line = line.split('#', 1)[0].replace(',', ' ').split()
+            if line:
+                yield line
+
+
+def element_records(args):
+    if args.euler:
+        for row, values in enumerate(read_rows(args.euler)):
+            if len(values) not in (3, 4):
+                raise RuntimeError('{}: expected 3 or 4 columns in row {}'.format(args.euler, row))
+            grain = int(values[3]) if len(values) == 4 else row
+            yield [float(v) for v in values[:3]], grain
+    else:
+        grains = [[float(v) for v in values[:3]] for values in read_rows(args.grain_euler)]
+        for row, values in enumerate(read_rows(args.element_grains)):
+            grain = int(values[0])
+            if grain >= len(grains):
+                raise RuntimeError('{}: grain {} of element {} has no orientation in {}'.format(
+                    args.element_grains, grain, row, args.grain_euler))
+            yield grains[grain], grain
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--euler', help='Per-element Euler angles and optional grain ids')
+    parser.add_argument('--grain-euler', help='Per-grain Euler angles')
+    parser.add_argument('--element-grains', help='Per-element grain ids')
+    parser.add_argument('output', help='Binary orientation file to write')
+    args = parser.parse_args()
+
+    if bool(args.euler) == bool(args.grain_euler and args.element_grains):
+        parser.error('give either --euler or both --grain-euler and --element-grains')
+
+    number_elements = 0
+    with open(args.output, 'wb') as out:
+        out.write(HEADER.pack(MAGIC, 0, RECORD.size, 0, 0))
+        for angles, grain in element_records(args):
+            out.write(RECORD.pack(angles[0], angles[1], angles[2], grain, 0))
+            number_elements += 1
+        out.seek(0)
+        out.write(HEADER.pack(MAGIC, number_elements, RECORD.size, 0, 0))
+
+    print('Wrote {} element orientations to {}'.format(number_elements, args.output))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
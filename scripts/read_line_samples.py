@@ -0,0 +1,105 @@
+#!/usr/bin/env python3
+"""
+Read the binary line sample files written by BinaryLineSampleOutput
+(see include/outputs/BinaryLineSampleOutput.h).
+
+The file is mapped, not read, so only the pages of the requested columns are touched, and it
+can be read while the run is still appending frames: only the frames counted in the header are
+complete, and a new LineSampleFile picks up the frames appended since.
+
+  read_line_samples.py FILE                     list the columns and frames
+  read_line_samples.py FILE COLUMN              write COLUMN of every frame as CSV, one row per
+                                                frame: time, value of every point
+  read_line_samples.py FILE COLUMN --frame N    write COLUMN of frame N (negative counts from the
+                                                end) as CSV, one row per point
+
+In Python, LineSampleFile(FILE).column(COLUMN, frame) returns a memoryview of the values.
+"""
+
+import argparse
+import mmap
+import struct
+import sys
+
+MAGIC = b'CDFLSP01'
+HEADER = struct.Struct('<8sQIIQQ24x')
+COLUMN_NAME_SIZE = 64
+
+
+class LineSampleFile:
+    def __init__(self, filename):
+        with open(filename, 'rb') as f:
+            self._map = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+        if len(self._map) < HEADER.size:
+            raise RuntimeError('{} is too short for a line sample file'.format(filename))
+
+        magic, _, self.number_columns, self.number_points, self._data_offset, \
+            self._frame_size = HEADER.unpack_from(self._map, 0)
+        if magic != MAGIC:
+            raise RuntimeError('{} is not a line sample file'.format(filename))
+
+        self.columns = []
+        for c in range(self.number_columns):
+            offset = HEADER.size + c * COLUMN_NAME_SIZE
+            name = self._map[offset:offset + COLUMN_NAME_SIZE].split(b'\0', 1)[0]
+            self.columns.append(name.decode())
+        # A frame may be partly written at the end of the file
+        self._values = memoryview(self._map)[:len(self._map) // 8 * 8].cast('d')
+
+    @property
+    def number_frames(self):
+        """Frames completely written so far and covered by the mapping"""
+        mapped_frames = (len(self._map) - self._data_offset) // self._frame_size
+        return min(struct.unpack_from('<Q', self._map, 8)[0], mapped_frames)
+
+    def _frame_start(self, frame):
+        """Index of the time of a frame in the values"""
+        number_frames = self.number_frames
+        if frame < 0:
+            frame += number_frames
+        if not 0 <= frame < number_frames:
+            raise IndexError('frame {} is not one of the {} frames'.format(frame, number_frames))
+        return (self._data_offset + frame * self._frame_size) // 8
+
+    def time(self, frame):
+        return self._values[self._frame_start(frame)]
+
+    def column(self, name, frame):
+        """Values of a column ("sampler/vector") in a frame"""
+        start = self._frame_start(frame) + 1 + self.columns.index(name) * self.number_points
+        return self._values[start:start + self.number_points]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('file', help='Binary line sample file')
+    parser.add_argument('column', nargs='?', help='Column to write, "sampler/vector"')
+    parser.add_argument('--frame', type=int, help='Only write this frame, one row per point')
+    args = parser.parse_args()
+
+    samples = LineSampleFile(args.file)
+    if args.column is None:
+        print('{} frames of {} points'.format(samples.number_frames, samples.number_points))
+        for name in samples.columns:
+            print(name)
+        return 0
+
+    if args.column not in samples.columns:
+        parser.error('{} has no column {}'.format(args.file, args.column))
+
+    if args.frame is not None:
+        print(args.column)
+        for value in samples.column(args.column, args.frame):
+            print(repr(value))
+    else:
+        print(','.join(['time'] + ['{}_{}'.format(args.column, p)
+                                   for p in range(samples.number_points)]))
+        for frame in range(samples.number_frames):
+            values = [samples.time(frame)] + list(samples.column(args.column, frame))
+            print(','.join(repr(v) for v in values))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,32 @@
+#!/bin/bash
+# Regenerate the gold CSV files and performance baselines of the reduced problems/
+# regression tests. Run from the repository root after building cdf_update, review
+# the differences and commit them together with the change that caused them.
+
+REPO_DIR="$( cd "$( dirname "${BASH_SOURCE[0]}" )" && pwd )/.."
+METHOD=${METHOD:-opt}
+APP="$REPO_DIR/cdf_update-$METHOD"
+
+if [[ ! -x $APP ]]; then
+    echo "'$APP' not found - build the application first" 1>&2
+    exit 1
+fi
+
+# Wall time and memory are stored relative to the reference workload run once on this machine
+pushd "$REPO_DIR/test/tests/performance" > /dev/null || exit 1
+"$APP" -i perf_reference.i || exit 1
+popd > /dev/null
+
+for dir in blp pileup single_crystal; do
+    pushd "$REPO_DIR/test/tests/$dir" > /dev/null || exit 1
+    mkdir -p gold
+    for input in *_reduced.i; do
+        name=${input%.i}
+        "$APP" -i "$input" || exit 1
+        cp "${name}_out.csv" gold/
+        python3 "$REPO_DIR/scripts/check_performance_baselines.py" --update --case "$name" \
+            --results "${name}_perf.csv" --reference ../performance/perf_reference_perf.csv \
+            --baseline perf_baselines.json || exit 1
+    done
+    popd > /dev/null
+done
@@ -0,0 +1,151 @@
+# Marks and indicators of the GND adaptivity objects on fixed density fields of four elements of
+# size h = 0.25. The positive density 2 x^2 and the negative density x are nodal, so the GND
+# gradient is constant on every element, 4 x_c - 1 at the element centre x_c, i.e. -0.5, 0.5,
+# 1.5 and 2.5. The marker measure h |grad rho_GND| is 0.125, 0.125, 0.375 and 0.625, which the
+# thresholds coarsen = 0.2 and refine = 0.5 turn into COARSEN (0), COARSEN (0), DO_NOTHING (1)
+# and REFINE (2). The jump indicators have to match the gradient and value jump indicators of
+# the framework on the GND density itself.
+
+[Mesh]
+  [gen]
+    type = GeneratedMeshGenerator
+    dim = 1
+    nx = 4
+    xmax = 1
+  []
+[]
+
+[Problem]
+  solve = false
+[]
+
+[AuxVariables]
+  [rho_pos]
+  []
+  [rho_neg]
+  []
+  [rho_gnd]
+  []
+  [rho_pos_dg]
+    order = FIRST
+    family = MONOMIAL
+  []
+  [rho_neg_dg]
+    order = FIRST
+    family = MONOMIAL
+  []
+  [rho_gnd_dg]
+    order = FIRST
+    family = MONOMIAL
+  []
+[]
+
+[ICs]
+  [rho_pos]
+    type = FunctionIC
+    variable = rho_pos
+    function = '2 * x * x'
+  []
+  [rho_neg]
+    type = FunctionIC
+    variable = rho_neg
+    function = 'x'
+  []
+  [rho_gnd]
+    type = FunctionIC
+    variable = rho_gnd
+    function = '2 * x * x - x'
+  []
+  [rho_pos_dg]
+    type = FunctionIC
+    variable = rho_pos_dg
+    function = '2 * x * x'
+  []
+  [rho_neg_dg]
+    type = FunctionIC
+    variable = rho_neg_dg
+    function = 'x'
+  []
+  [rho_gnd_dg]
+    type = FunctionIC
+    variable = rho_gnd_dg
+    function = '2 * x * x - x'
+  []
+[]
+
+[Adaptivity]
+  [Indicators]
+    [gnd_gradient_jump]
+      type = GNDJumpIndicator
+      variable = rho_pos
+      positive_densities = rho_pos
+      negative_densities = rho_neg
+    []
+    [gradient_jump]
+      type = GradientJumpIndicator
+      variable = rho_gnd
+    []
+    [gnd_value_jump]
+      type = GNDJumpIndicator
+      variable = rho_pos_dg
+      positive_densities = rho_pos_dg
+      negative_densities = rho_neg_dg
+      jump_type = value
+    []
+    [value_jump]
+      type = ValueJumpIndicator
+      variable = rho_gnd_dg
+    []
+  []
+  [Markers]
+    [gnd_gradient]
+      type = GNDGradientMarker
+      variable = rho_pos
+      positive_densities = rho_pos
+      negative_densities = rho_neg
+      refine = 0.5
+      coarsen = 0.2
+    []
+  []
+[]
+
+[Postprocessors]
+  [gradient_jump_difference]
+    type = ElementL2Difference
+    variable = gnd_gradient_jump
+    other_variable = gradient_jump
+  []
+  [value_jump_difference]
+    type = ElementL2Difference
+    variable = gnd_value_jump
+    other_variable = value_jump
+  []
+[]
+
+[UserObjects]
+  [check]
+    type = Terminator
+    expression = 'gradient_jump_difference > 1e-12 | value_jump_difference > 1e-12'
+    fail_mode = HARD
+    error_level = ERROR
+  []
+[]
+
+[VectorPostprocessors]
+  [marks]
+    type = ElementValueSampler
+    variable = gnd_gradient
+    sort_by = id
+  []
+[]
+
+# The indicators and markers are computed at the end of a time step, the second step samples
+# those of the first
+[Executioner]
+  type = Transient
+  num_steps = 2
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,361 @@
+# Implicit-explicit version of blp_explicit_reduced.i: the mechanics is solved implicitly and
+# the densities, auxiliary variables here, are advanced after every converged step by
+# ExplicitDislocationTransport with SSP-RK3, so the nonlinear system only holds the displacements.
+# The explicit transport, like the full-upwind advection kernels, applies no SSD source.
+
+[GlobalParams]
+  displacements = 'disp_x disp_y'
+[]
+
+[Mesh]
+  [./gen]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 1
+    ny = 10
+    xmin = 0.0
+    ymin = 0.0
+    xmax = 0.04
+    ymax = 0.4
+  []
+  [./pin_point]
+    type = BoundingBoxNodeSetGenerator
+    new_boundary = 'pin'
+    input = 'gen'
+    top_right = '-0.00001 -0.00001 0'
+    bottom_left = '0.00001 0.00001 0'
+  []
+[]
+
+[Variables]
+  [disp_x]
+    order = FIRST
+      family = LAGRANGE
+  []
+  [disp_y]
+    order = FIRST
+      family = LAGRANGE
+  []
+[]
+
+[AuxVariables]
+  [rho_edge_pos_1]
+    initial_condition = 1.e6
+  []
+  [rho_edge_neg_1]
+    initial_condition = 1.e6
+  []
+  [rho_edge_pos_2]
+    initial_condition = 1.e6
+  []
+  [rho_edge_neg_2]
+    initial_condition = 1.e6
+  []
+  [./pk2]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./fp_xy]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./exy]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./slip_increment]
+   order = CONSTANT
+   family = MONOMIAL
+  [../]
+  [./dislo_velocity]
+   order = CONSTANT
+   family = MONOMIAL
+  [../]
+  [./epeq]
+   order = CONSTANT
+   family = MONOMIAL
+  [../]
+[]
+
+[Functions]
+  [disp_load]
+    type = ParsedFunction
+    expression = '0.005*4.0*t'
+  []
+[]
+
+[Physics/SolidMechanics/QuasiStatic/all]
+  strain = FINITE
+  add_variables = true
+  generate_output = 'stress_xy'
+  additional_generate_output = 'strain_xy'
+[]
+
+[UserObjects]
+  [transport]
+    type = ExplicitDislocationTransport
+    densities = 'rho_edge_pos_1 rho_edge_neg_1 rho_edge_pos_2 rho_edge_neg_2'
+    slip_sys_index = '0 0 1 1'
+    dislo_sign = 'positive negative positive negative'
+    dislo_character = 'edge edge edge edge'
+    scheme = ssp_rk3
+    max_courant = 0.5
+    periodic_variable = disp_x
+  []
+[]
+
+[AuxKernels]
+  [./pk2]
+   type = RankTwoAux
+   variable = pk2
+   rank_two_tensor = second_piola_kirchhoff_stress
+   index_j = 0
+   index_i = 0
+   execute_on = timestep_end
+  [../]
+  [./exy]
+    type = RankTwoAux
+    variable = exy
+    rank_two_tensor = total_lagrangian_strain
+    index_j = 0
+    index_i = 1
+    execute_on = timestep_end
+  [../]
+  [./fp_xy]
+    type = RankTwoAux
+    variable = fp_xy
+    rank_two_tensor = plastic_deformation_gradient
+    index_j = 0
+    index_i = 1
+    execute_on = timestep_end
+  [../]
+  [./slip_inc]
+   type = MaterialStdVectorAux
+   variable = slip_increment
+   property = slip_increment
+   index = 0
+   execute_on = timestep_end
+  [../]
+  [./dislo_vel]
+   type = MaterialStdVectorAux
+   variable = dislo_velocity
+   property = dislo_velocity
+   index = 0
+   execute_on = timestep_end
+  [../]
+  [./epeq]
+   type = MaterialRealAux
+   variable = epeq
+   property = accumulated_equivalent_plastic_strain
+   execute_on = timestep_end
+  [../]
+[]
+
+[Materials]
+  [./elasticity_tensor]
+    type = ComputeElasticityTensorCP
+    C_ijkl = '1.129e5 0.664e5 0.664e5 1.129e5 0.664e5 1.129e5 0.279e5 0.279e5 0.279e5'
+    fill_method = symmetric9
+    euler_angle_1 = 0.0
+    euler_angle_2 = 0.0 
+    euler_angle_3 = 0.0 
+  [../]
+  [./stress]
+    type = ComputeCrystalPlasticityDislocationStress
+    crystal_plasticity_models = 'trial_xtalpl'
+    tan_mod_type = exact
+  [../]
+  [./trial_xtalpl]
+    type = CrystalPlasticityBussoUpdate
+    number_slip_systems = 2
+    slip_sys_file_name = input_slip_sys_al.txt
+      w1 = 0.0
+      w2 = 0.0
+      tau_0 = 8.0
+      p = 0.141
+      q = 1.1
+      f0 = 3.e-19
+      gdot0 = 1.73e6
+      scaling_Cb = 0.241
+    edge_dislo_den_pos_1 = rho_edge_pos_1
+    edge_dislo_den_neg_1 = rho_edge_neg_1
+    edge_dislo_den_pos_2 = rho_edge_pos_2
+    edge_dislo_den_neg_2 = rho_edge_neg_2
+      is_two_slips = yes
+  [../]
+[]
+
+[BCs]
+  [bottom_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = 'bottom'
+    value = 0.0
+  []
+  [bottom_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = 'bottom'
+    value = 0.0
+  []
+
+  [top_x]
+    type = FunctionDirichletBC
+    variable = disp_x
+    boundary = 'top'
+    function = disp_load
+  []
+  [top_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = 'top'
+    value = 0.0
+  []
+
+  [./Periodic]
+
+    [./auto_boundary_x]
+      variable = disp_x
+      primary = 'left'
+    secondary = 'right'
+    translation = '0.04 0.0 0.0'
+    [../]
+
+    [./auto_boundary_y]
+      variable = disp_y
+      primary = 'left'
+    secondary = 'right'
+    translation = '0.04 0.0 0.0'
+    [../]
+
+  [../]
+
+[]
+
+[Preconditioning]
+  active = 'smp'
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+# Transient (time-dependent) details for simulations go here:
+[Executioner]
+
+  type = Transient
+  solve_type = 'NEWTON'
+  petsc_options = '-snes_ksp_ew'
+  petsc_options_iname = '-pc_type -pc_hypre_type -ksp_gmres_restart'
+  petsc_options_value = 'lu    boomeramg          31'
+  line_search = 'none'
+  l_max_its = 50
+  nl_max_its = 50
+  nl_rel_tol = 1e-5
+  nl_abs_tol = 1e-3
+  l_tol = 1e-5
+
+  start_time = 0.0
+  num_steps = 10
+  dt = 5.e-6
+  dtmin = 1.e-9
+[]
+
+[Postprocessors]
+  [wall_time]
+    type = PerfGraphData
+    section_name = 'FEProblem::solve'
+    data_type = TOTAL
+    must_exist = false
+  []
+  [nonlinear_its]
+    type = NumNonlinearIterations
+  []
+  [linear_its]
+    type = NumLinearIterations
+  []
+  [total_nonlinear_its]
+    type = CumulativeValuePostprocessor
+    postprocessor = nonlinear_its
+  []
+  [total_linear_its]
+    type = CumulativeValuePostprocessor
+    postprocessor = linear_its
+  []
+  [peak_memory]
+    type = MemoryUsage
+    mem_type = physical_memory
+    value_type = max_process
+    mem_units = megabytes
+  []
+  [./stress_xy]
+    type = ElementAverageValue
+    variable = stress_xy
+  [../]
+  [./pk2]
+   type = ElementAverageValue
+   variable = pk2
+  [../]
+  [./fp_xy]
+    type = ElementAverageValue
+    variable = fp_xy
+  [../]
+  [./exy]
+    type = ElementAverageValue
+    variable = exy
+  [../]
+  [./slip_increment]
+   type = ElementAverageValue
+   variable = slip_increment
+  [../]
+  [./dislo_velocity]
+   type = ElementAverageValue
+   variable = dislo_velocity
+  [../]
+  [./disp_x]
+     type = NodalVariableValue
+     variable = disp_x
+     nodeid = 101
+  [../]
+  [./strain_xy]
+    type = ElementAverageValue
+    variable = strain_xy
+  [../]
+  [./epeq]
+    type = ElementAverageValue
+    variable = epeq
+  [../]
+[]
+
+[VectorPostprocessors]
+  [rhoep]
+    type = LineValueSampler
+    variable = rho_edge_pos_1
+    start_point = '0.005 0 0'
+    end_point = '0.005 0.4 0'
+    num_points = 51
+    sort_by = y
+  []
+  [rhoen]
+    type = LineValueSampler
+    variable = rho_edge_neg_1
+    start_point = '0.005 0 0'
+    end_point = '0.005 0.4 0'
+    num_points = 51
+    sort_by = y
+  []
+[]
+
+[Outputs]
+  [csv]
+    type = CSV
+    hide = 'wall_time nonlinear_its linear_its total_nonlinear_its total_linear_its peak_memory'
+    execute_on = 'timestep_end'
+  []
+  [perf]
+    type = CSV
+    file_base = blp_imex_reduced_perf
+    show = 'wall_time total_nonlinear_its total_linear_its peak_memory'
+    execute_on = 'final'
+  []
+[]
@@ -0,0 +1,77 @@
+# Parameter recovery from synthetic data: synthetic_stress_strain.csv is the [001] response of
+# the FCC crystal for p = 0.3, q = 1.3, tau_0 = 120 and dlamb = 0.3, the third row of
+# busso_parameter_sets.csv. The other rows perturb one parameter each. The run is terminated
+# with an error unless every set converges and the generating set reproduces the curve with the
+# smallest objective.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 1
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[VectorPostprocessors]
+  [calibration]
+    type = BussoCalibrationBatch
+    parameter_sets_file = busso_parameter_sets.csv
+    experimental_data_file = synthetic_stress_strain.csv
+    strain_rate = 1.0e-3
+    youngs_modulus = 70000.0
+    loading_direction = '0 0 1'
+    slip_sys_file_name = input_slip_fcc_sys.txt
+    dislocation_density = 1.6e4
+    rtol = 1e-10
+    execute_on = initial
+  []
+[]
+
+[Postprocessors]
+  [objective_true]
+    type = VectorPostprocessorComponent
+    vectorpostprocessor = calibration
+    vector_name = objective
+    index = 2
+    execute_on = initial
+  []
+  [objective_min]
+    type = VectorPostprocessorReductionValue
+    vectorpostprocessor = calibration
+    vector_name = objective
+    value_type = min
+    execute_on = initial
+  []
+  [converged]
+    type = VectorPostprocessorReductionValue
+    vectorpostprocessor = calibration
+    vector_name = converged
+    value_type = sum
+    execute_on = initial
+  []
+[]
+
+[UserObjects]
+  [recovered]
+    type = Terminator
+    expression = 'objective_true > 1e-12 | objective_min < objective_true | converged < 5'
+    fail_mode = HARD
+    error_level = ERROR
+    execute_on = initial
+  []
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  [csv]
+    type = CSV
+    file_base = busso_calibration_out
+    execute_on = final
+  []
+[]
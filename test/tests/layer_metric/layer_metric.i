@@ -0,0 +1,91 @@
+# Layer metrics of elementwise constant densities on four elements of size 0.25, measured from
+# the plane x = 1 with one quadrature point per element, at the element centres x = 0.125,
+# 0.375, 0.625 and 0.875, i.e. at the distances 0.875, 0.625, 0.375 and 0.125.
+#
+# The positive density is 1, 3, 3 and 0.5 and the negative density 0.5, so the GND measure is
+# 0.5, 2.5, 2.5 and 0. The peak 2.5 is taken by two elements, the closer one gives the peak
+# distance 0.375. The extent above 0.3 times the peak (0.75) is the distance of the second
+# element, 0.625, and the extent above the absolute value 0.4 the distance of the first one,
+# 0.875. The sum of the densities normalised by 0.5 is 3, 7, 7 and 2, with the peak 7.
+
+[Mesh]
+  [gen]
+    type = GeneratedMeshGenerator
+    dim = 1
+    nx = 4
+    xmax = 1
+  []
+[]
+
+[Problem]
+  solve = false
+[]
+
+[AuxVariables]
+  [rho_pos]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [rho_neg]
+    order = CONSTANT
+    family = MONOMIAL
+    initial_condition = 0.5
+  []
+[]
+
+[ICs]
+  [rho_pos]
+    type = FunctionIC
+    variable = rho_pos
+    function = 'if(x < 0.25, 1, if(x < 0.75, 3, 0.5))'
+  []
+[]
+
+[GlobalParams]
+  positive_densities = rho_pos
+  negative_densities = rho_neg
+  reference_point = '1 0 0'
+  direction = '1 0 0'
+[]
+
+[Postprocessors]
+  [peak]
+    type = DislocationLayerMetric
+    metric = peak
+  []
+  [peak_distance]
+    type = DislocationLayerMetric
+    metric = peak_distance
+  []
+  [extent_fraction]
+    type = DislocationLayerMetric
+    metric = extent
+    threshold = 0.3
+  []
+  [extent_absolute]
+    type = DislocationLayerMetric
+    metric = extent
+    threshold_type = absolute
+    threshold = 0.4
+  []
+  [sum_peak]
+    type = DislocationLayerMetric
+    metric = peak
+    measure = sum
+    initial_total_dislo_den = 0.5
+  []
+[]
+
+[Executioner]
+  type = Steady
+  [Quadrature]
+    order = CONSTANT
+  []
+[]
+
+[Outputs]
+  [csv]
+    type = CSV
+    execute_on = timestep_end
+  []
+[]
@@ -0,0 +1,67 @@
+# Binary line samples of the elementwise constant fields rho = t (1 + floor(4 x)) and
+# rho2 = 10 rho on four elements, sampled at the element centres at the times 1 and 2. The
+# values are exact in binary, so that the columns read back from the file can be compared
+# digit by digit: 1, 2, 3, 4 and 2, 4, 6, 8 for rho, ten times that for rho2.
+
+[Mesh]
+  [gen]
+    type = GeneratedMeshGenerator
+    dim = 1
+    nx = 4
+    xmax = 1
+  []
+[]
+
+[Problem]
+  solve = false
+[]
+
+[AuxVariables]
+  [rho]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [rho2]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[AuxKernels]
+  [rho]
+    type = FunctionAux
+    variable = rho
+    function = 't * (1 + floor(4 * x))'
+    execute_on = timestep_end
+  []
+  [rho2]
+    type = FunctionAux
+    variable = rho2
+    function = '10 * t * (1 + floor(4 * x))'
+    execute_on = timestep_end
+  []
+[]
+
+[VectorPostprocessors]
+  [profile]
+    type = LineValueSampler
+    variable = 'rho rho2'
+    start_point = '0.125 0 0'
+    end_point = '0.875 0 0'
+    num_points = 4
+    sort_by = x
+  []
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 2
+[]
+
+[Outputs]
+  [line_samples]
+    type = BinaryLineSampleOutput
+    samplers = profile
+    file_base = line_samples_out
+  []
+[]
@@ -0,0 +1,57 @@
+# Element ids and ranks of a 5 x 2 mesh renumbered along x and cut into strips along x on three
+# ranks. GeneratedMeshGenerator numbers the elements row by row, the renumbering orders them
+# column by column, and the 10 elements are split into strips of 4, 3 and 3 elements.
+
+[Mesh]
+  [gen]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 5
+    ny = 2
+    xmax = 1
+    ymax = 0.4
+  []
+  [renumber]
+    type = StreamwiseRenumberGenerator
+    input = gen
+  []
+  parallel_type = replicated
+
+  [Partitioner]
+    type = StripPartitioner
+  []
+[]
+
+[Problem]
+  solve = false
+[]
+
+[AuxVariables]
+  [rank]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[AuxKernels]
+  [rank]
+    type = ProcessorIDAux
+    variable = rank
+  []
+[]
+
+[VectorPostprocessors]
+  [elements]
+    type = ElementValueSampler
+    variable = rank
+    sort_by = id
+  []
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,89 @@
+# Fixed reference workload of the performance baselines. scripts/update_regression_gold.sh runs
+# it once before the reduced cases, and scripts/check_performance_baselines.py compares the wall
+# time and memory of the cases as ratios to this run, so the baselines do not depend on the
+# speed of the machine.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 100
+  ny = 100
+[]
+
+[Variables]
+  [u]
+  []
+[]
+
+[Kernels]
+  [time]
+    type = TimeDerivative
+    variable = u
+  []
+  [diff]
+    type = Diffusion
+    variable = u
+  []
+[]
+
+[BCs]
+  [left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  []
+  [right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'PJFNK'
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+  num_steps = 10
+  dt = 0.1
+[]
+
+[Postprocessors]
+  [wall_time]
+    type = PerfGraphData
+    section_name = 'FEProblem::solve'
+    data_type = TOTAL
+    must_exist = false
+  []
+  [nonlinear_its]
+    type = NumNonlinearIterations
+  []
+  [linear_its]
+    type = NumLinearIterations
+  []
+  [total_nonlinear_its]
+    type = CumulativeValuePostprocessor
+    postprocessor = nonlinear_its
+  []
+  [total_linear_its]
+    type = CumulativeValuePostprocessor
+    postprocessor = linear_its
+  []
+  [peak_memory]
+    type = MemoryUsage
+    mem_type = physical_memory
+    value_type = max_process
+    mem_units = megabytes
+  []
+[]
+
+[Outputs]
+  [perf]
+    type = CSV
+    file_base = perf_reference_perf
+    show = 'wall_time total_nonlinear_its total_linear_its peak_memory'
+    execute_on = 'final'
+  []
+[]
@@ -0,0 +1,230 @@
+# One HEX8 element of a BCC single crystal with 48 slip systems (5 time steps), as
+# bcc48_generic_reduced.i, with the crystal orientation of the element read from the
+# memory-mapped binary file orientation_one_element.bin.
+
+[GlobalParams]
+  displacements = 'disp_x disp_y disp_z'
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 1
+  ny = 1
+  nz = 1
+  elem_type = HEX8
+[]
+
+[AuxVariables]
+  [rho_total]
+    initial_condition = 1.6e4
+  []
+  [pk2]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [fp_xx]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [slip_increment]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[Physics/SolidMechanics/QuasiStatic/all]
+  strain = FINITE
+  add_variables = true
+  generate_output = 'stress_xx'
+  additional_generate_output = 'strain_xx'
+[]
+
+[AuxKernels]
+  [pk2]
+    type = RankTwoAux
+    variable = pk2
+    rank_two_tensor = second_piola_kirchhoff_stress
+    index_j = 0
+    index_i = 0
+    execute_on = timestep_end
+  []
+  [fp_xx]
+    type = RankTwoAux
+    variable = fp_xx
+    rank_two_tensor = plastic_deformation_gradient
+    index_j = 0
+    index_i = 0
+    execute_on = timestep_end
+  []
+  [slip_inc]
+    type = MaterialStdVectorAux
+    variable = slip_increment
+    property = slip_increment
+    index = 0
+    execute_on = timestep_end
+  []
+[]
+
+[BCs]
+  [symmy]
+    type = DirichletBC
+    variable = disp_y
+    boundary = bottom
+    value = 0
+  []
+  [symmx]
+    type = DirichletBC
+    variable = disp_x
+    boundary = left
+    value = 0
+  []
+  [symmz]
+    type = DirichletBC
+    variable = disp_z
+    boundary = back
+    value = 0
+  []
+  [tdisp]
+    type = FunctionDirichletBC
+    variable = disp_x
+    boundary = right
+    function = '0.003*t'
+  []
+[]
+
+[UserObjects]
+  [bcc48_slip_systems]
+    type = SlipSystemRegistry
+    slip_sys_file_name = input_slip_bcc48_sys.txt
+    crystal_lattice_type = BCC
+  []
+  [orientations]
+    type = BinaryOrientationReader
+    orientation_file_name = orientation_one_element.bin
+  []
+[]
+
+[Materials]
+  [elasticity_tensor]
+    type = ComputeElasticityTensorCPBinaryOrientation
+    orientation_reader = orientations
+    C_ijkl = '231400.0 134700.0 134700.0 231400.0 134700.0 231400.0 116400.0 116400.0 116400.0'
+    fill_method = symmetric9
+  []
+  [stress]
+    type = ComputeCrystalPlasticityDislocationStress
+    crystal_plasticity_models = 'trial_xtalpl'
+    tan_mod_type = exact
+  []
+  [trial_xtalpl]
+    type = CrystalPlasticityBussoUpdateGeneric
+    number_slip_systems = 48
+    slip_system_registry = bcc48_slip_systems
+    number_cross_slip_directions = 4
+    number_cross_slip_planes = 12
+    tau_0 = 20.0
+    p = 0.2
+    q = 1.2
+    w1 = 1.5
+    w2 = 1.2
+    coplanar_interaction = 1.5
+    collinear_interaction = 1.2
+    junction_interaction = 1.6
+    total_densities = 'rho_total rho_total rho_total rho_total rho_total rho_total rho_total rho_total
+                     rho_total rho_total rho_total rho_total rho_total rho_total rho_total rho_total
+                     rho_total rho_total rho_total rho_total rho_total rho_total rho_total rho_total
+                     rho_total rho_total rho_total rho_total rho_total rho_total rho_total rho_total
+                     rho_total rho_total rho_total rho_total rho_total rho_total rho_total rho_total
+                     rho_total rho_total rho_total rho_total rho_total rho_total rho_total rho_total'
+  []
+[]
+
+[Postprocessors]
+  [wall_time]
+    type = PerfGraphData
+    section_name = 'FEProblem::solve'
+    data_type = TOTAL
+    must_exist = false
+  []
+  [nonlinear_its]
+    type = NumNonlinearIterations
+  []
+  [linear_its]
+    type = NumLinearIterations
+  []
+  [total_nonlinear_its]
+    type = CumulativeValuePostprocessor
+    postprocessor = nonlinear_its
+  []
+  [total_linear_its]
+    type = CumulativeValuePostprocessor
+    postprocessor = linear_its
+  []
+  [peak_memory]
+    type = MemoryUsage
+    mem_type = physical_memory
+    value_type = max_process
+    mem_units = megabytes
+  []
+  [stress_xx]
+    type = ElementAverageValue
+    variable = stress_xx
+  []
+  [pk2]
+    type = ElementAverageValue
+    variable = pk2
+  []
+  [fp_xx]
+    type = ElementAverageValue
+    variable = fp_xx
+  []
+  [slip_increment]
+    type = ElementAverageValue
+    variable = slip_increment
+  []
+  [strain_xx]
+    type = ElementAverageValue
+    variable = strain_xx
+  []
+[]
+
+[Preconditioning]
+  [smp]
+    type = SMP
+    full = true
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  petsc_options = '-snes_ksp_ew'
+  petsc_options_iname = '-pc_type -ksp_gmres_restart'
+  petsc_options_value = 'lu       31'
+  line_search = 'none'
+  l_max_its = 50
+  nl_max_its = 50
+  nl_rel_tol = 1e-5
+  nl_abs_tol = 1e-3
+  l_tol = 1e-5
+
+  start_time = 0.0
+  num_steps = 5
+  dt = 5.e-4
+  dtmin = 1.e-9
+[]
+
+[Outputs]
+  [csv]
+    type = CSV
+    hide = 'wall_time nonlinear_its linear_its total_nonlinear_its total_linear_its peak_memory'
+    execute_on = 'timestep_end'
+  []
+  [perf]
+    type = CSV
+    file_base = bcc48_binary_orientation_reduced_perf
+    show = 'wall_time total_nonlinear_its total_linear_its peak_memory'
+    execute_on = 'final'
+  []
+[]
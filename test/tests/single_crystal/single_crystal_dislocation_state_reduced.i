@@ -0,0 +1,2103 @@
+# Reduced-size regression version of problems/3D_TEST/single_crystal_one_element.i in which the
+# densities are gathered once by a DislocationDensityState shared by the FCC and SSD models and
+# the per slip system fields are written by array auxiliary kernels
+# (one HEX8 element, 5 time steps).
+
+[GlobalParams]
+  displacements = 'disp_x disp_y disp_z'
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 1
+  ny = 1
+  nz = 1
+  xmin = 0.0
+  ymin = 0.0
+  zmin = 0.0
+  xmax = 1.0
+  ymax = 1.0
+  zmax = 1.0
+  elem_type = HEX8
+[]
+
+[Variables]
+  [disp_x]
+    order = FIRST
+      family = LAGRANGE
+  []
+  [disp_y]
+    order = FIRST
+      family = LAGRANGE
+  []
+  [disp_z]
+    order = FIRST
+      family = LAGRANGE
+  []
+  [edge_dislo_1_Q1]
+    initial_condition = 2.e3
+  []
+  [edge_dislo_1_Q2]
+    initial_condition = 2.e3
+  []
+  [edge_dislo_1_Q3]
+    initial_condition = 2.e3
+  []
+  [edge_dislo_1_Q4]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_1_Q1]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_1_Q2]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_1_Q3]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_1_Q4]
+    initial_condition = 2.e3
+  []
+  
+  [edge_dislo_2_Q1]
+    initial_condition = 2.e3
+  []
+  [edge_dislo_2_Q2]
+    initial_condition = 2.e3
+  []
+  [edge_dislo_2_Q3]
+    initial_condition = 2.e3
+  []
+  [edge_dislo_2_Q4]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_2_Q1]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_2_Q2]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_2_Q3]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_2_Q4]
+    initial_condition = 2.e3
+  []
+
+  [edge_dislo_3_Q1]
+    initial_condition = 2.e3
+  []
+  [edge_dislo_3_Q2]
+    initial_condition = 2.e3
+  []
+  [edge_dislo_3_Q3]
+    initial_condition = 2.e3
+  []
+  [edge_dislo_3_Q4]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_3_Q1]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_3_Q2]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_3_Q3]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_3_Q4]
+    initial_condition = 2.e3
+  []
+
+  [edge_dislo_4_Q1]
+    initial_condition = 2.e3
+  []
+  [edge_dislo_4_Q2]
+    initial_condition = 2.e3
+  []
+  [edge_dislo_4_Q3]
+    initial_condition = 2.e3
+  []
+  [edge_dislo_4_Q4]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_4_Q1]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_4_Q2]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_4_Q3]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_4_Q4]
+    initial_condition = 2.e3
+  []
+
+  [edge_dislo_5_Q1]
+    initial_condition = 2.e3
+  []
+  [edge_dislo_5_Q2]
+    initial_condition = 2.e3
+  []
+  [edge_dislo_5_Q3]
+    initial_condition = 2.e3
+  []
+  [edge_dislo_5_Q4]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_5_Q1]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_5_Q2]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_5_Q3]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_5_Q4]
+    initial_condition = 2.e3
+  []
+
+  [edge_dislo_6_Q1]
+    initial_condition = 2.e3
+  []
+  [edge_dislo_6_Q2]
+    initial_condition = 2.e3
+  []
+  [edge_dislo_6_Q3]
+    initial_condition = 2.e3
+  []
+  [edge_dislo_6_Q4]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_6_Q1]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_6_Q2]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_6_Q3]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_6_Q4]
+    initial_condition = 2.e3
+  []
+
+  [edge_dislo_7_Q1]
+    initial_condition = 2.e3
+  []
+  [edge_dislo_7_Q2]
+    initial_condition = 2.e3
+  []
+  [edge_dislo_7_Q3]
+    initial_condition = 2.e3
+  []
+  [edge_dislo_7_Q4]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_7_Q1]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_7_Q2]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_7_Q3]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_7_Q4]
+    initial_condition = 2.e3
+  []
+
+  [edge_dislo_8_Q1]
+    initial_condition = 2.e3
+  []
+  [edge_dislo_8_Q2]
+    initial_condition = 2.e3
+  []
+  [edge_dislo_8_Q3]
+    initial_condition = 2.e3
+  []
+  [edge_dislo_8_Q4]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_8_Q1]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_8_Q2]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_8_Q3]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_8_Q4]
+    initial_condition = 2.e3
+  []
+
+  [edge_dislo_9_Q1]
+    initial_condition = 2.e3
+  []
+  [edge_dislo_9_Q2]
+    initial_condition = 2.e3
+  []
+  [edge_dislo_9_Q3]
+    initial_condition = 2.e3
+  []
+  [edge_dislo_9_Q4]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_9_Q1]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_9_Q2]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_9_Q3]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_9_Q4]
+    initial_condition = 2.e3
+  []
+
+  [edge_dislo_10_Q1]
+    initial_condition = 2.e3
+  []
+  [edge_dislo_10_Q2]
+    initial_condition = 2.e3
+  []
+  [edge_dislo_10_Q3]
+    initial_condition = 2.e3
+  []
+  [edge_dislo_10_Q4]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_10_Q1]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_10_Q2]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_10_Q3]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_10_Q4]
+    initial_condition = 2.e3
+  []
+
+  [edge_dislo_11_Q1]
+    initial_condition = 2.e3
+  []
+  [edge_dislo_11_Q2]
+    initial_condition = 2.e3
+  []
+  [edge_dislo_11_Q3]
+    initial_condition = 2.e3
+  []
+  [edge_dislo_11_Q4]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_11_Q1]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_11_Q2]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_11_Q3]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_11_Q4]
+    initial_condition = 2.e3
+  []
+
+  [edge_dislo_12_Q1]
+    initial_condition = 2.e3
+  []
+  [edge_dislo_12_Q2]
+    initial_condition = 2.e3
+  []
+  [edge_dislo_12_Q3]
+    initial_condition = 2.e3
+  []
+  [edge_dislo_12_Q4]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_12_Q1]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_12_Q2]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_12_Q3]
+    initial_condition = 2.e3
+  []
+  [screw_dislo_12_Q4]
+    initial_condition = 2.e3
+  []
+[]
+
+[AuxVariables]
+  [./pk2]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./fp_xx]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./e_xx]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./slip_increment]
+   order = CONSTANT
+   family = MONOMIAL
+  [../]
+  [./dislo_velocity]
+   order = CONSTANT
+   family = MONOMIAL
+  [../]
+  [./epeq]
+   order = CONSTANT
+   family = MONOMIAL
+  [../]
+  [slip_increments]
+    order = CONSTANT
+    family = MONOMIAL
+    components = 12
+  []
+  [total_densities]
+    order = CONSTANT
+    family = MONOMIAL
+    components = 12
+  []
+  [total_density_sum_1]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[Physics/SolidMechanics/QuasiStatic/all]
+  strain = FINITE
+  add_variables = true
+  generate_output = 'stress_xx'
+  additional_generate_output = 'strain_xx'
+[]
+
+[Kernels]
+  # Slip 1 
+  [Edge_Dislo_Den_Slip_1_Q1_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_1_Q1
+  []
+  [Edge_Dislo_Den_Slip_1_Q1_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_1_Q1
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 0
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [Edge_Dislo_Den_Slip_1_Q2_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_1_Q2
+  []
+  [Edge_Dislo_Den_Slip_1_Q2_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_1_Q2
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 0
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [Edge_Dislo_Den_Slip_1_Q3_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_1_Q3
+  []
+  [Edge_Dislo_Den_Slip_1_Q3_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_1_Q3
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 0
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [Edge_Dislo_Den_Slip_1_Q4_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_1_Q4
+  []
+  [Edge_Dislo_Den_Slip_1_Q4_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_1_Q4
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 0
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_1_Q1_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_1_Q1
+  []
+  [screw_Dislo_Den_Slip_1_Q1_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_1_Q1
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 0
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_1_Q2_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_1_Q2
+  []
+  [screw_Dislo_Den_Slip_1_Q2_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_1_Q2
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 0
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_1_Q3_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_1_Q3
+  []
+  [screw_Dislo_Den_Slip_1_Q3_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_1_Q3
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 0
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_1_Q4_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_1_Q4
+  []
+  [screw_Dislo_Den_Slip_1_Q4_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_1_Q4
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 0
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  # Slip 2
+  [Edge_Dislo_Den_Slip_2_Q1_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_2_Q1
+  []
+  [Edge_Dislo_Den_Slip_2_Q1_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_2_Q1
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 1
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [Edge_Dislo_Den_Slip_2_Q2_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_2_Q2
+  []
+  [Edge_Dislo_Den_Slip_2_Q2_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_2_Q2
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 1
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [Edge_Dislo_Den_Slip_2_Q3_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_2_Q3
+  []
+  [Edge_Dislo_Den_Slip_2_Q3_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_2_Q3
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 1
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [Edge_Dislo_Den_Slip_2_Q4_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_2_Q4
+  []
+  [Edge_Dislo_Den_Slip_2_Q4_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_2_Q4
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 1
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_2_Q1_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_2_Q1
+  []
+  [screw_Dislo_Den_Slip_2_Q1_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_2_Q1
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 1
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_2_Q2_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_2_Q2
+  []
+  [screw_Dislo_Den_Slip_2_Q2_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_2_Q2
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 1
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_2_Q3_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_2_Q3
+  []
+  [screw_Dislo_Den_Slip_2_Q3_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_2_Q3
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 1
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_2_Q4_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_2_Q4
+  []
+  [screw_Dislo_Den_Slip_2_Q4_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_2_Q4
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 1
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  # Slip 3 
+  [Edge_Dislo_Den_Slip_3_Q1_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_3_Q1
+  []
+  [Edge_Dislo_Den_Slip_3_Q1_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_3_Q1
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 2
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [Edge_Dislo_Den_Slip_3_Q2_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_3_Q2
+  []
+  [Edge_Dislo_Den_Slip_3_Q2_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_3_Q2
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 2
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [Edge_Dislo_Den_Slip_3_Q3_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_3_Q3
+  []
+  [Edge_Dislo_Den_Slip_3_Q3_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_3_Q3
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 2
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [Edge_Dislo_Den_Slip_3_Q4_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_3_Q4
+  []
+  [Edge_Dislo_Den_Slip_3_Q4_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_3_Q4
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 2
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_3_Q1_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_3_Q1
+  []
+  [screw_Dislo_Den_Slip_3_Q1_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_3_Q1
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 2
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_3_Q2_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_3_Q2
+  []
+  [screw_Dislo_Den_Slip_3_Q2_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_3_Q2
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 2
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_3_Q3_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_3_Q3
+  []
+  [screw_Dislo_Den_Slip_3_Q3_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_3_Q3
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 2
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_3_Q4_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_3_Q4
+  []
+  [screw_Dislo_Den_Slip_3_Q4_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_3_Q4
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 2
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  # Slip 4
+  [Edge_Dislo_Den_Slip_4_Q1_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_4_Q1
+  []
+  [Edge_Dislo_Den_Slip_4_Q1_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_4_Q1
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 3
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [Edge_Dislo_Den_Slip_4_Q2_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_4_Q2
+  []
+  [Edge_Dislo_Den_Slip_4_Q2_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_4_Q2
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 3
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [Edge_Dislo_Den_Slip_4_Q3_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_4_Q3
+  []
+  [Edge_Dislo_Den_Slip_4_Q3_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_4_Q3
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 3
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [Edge_Dislo_Den_Slip_4_Q4_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_4_Q4
+  []
+  [Edge_Dislo_Den_Slip_4_Q4_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_4_Q4
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 3
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_4_Q1_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_4_Q1
+  []
+  [screw_Dislo_Den_Slip_4_Q1_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_4_Q1
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 3
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_4_Q2_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_4_Q2
+  []
+  [screw_Dislo_Den_Slip_4_Q2_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_4_Q2
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 3
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_4_Q3_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_4_Q3
+  []
+  [screw_Dislo_Den_Slip_4_Q3_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_4_Q3
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 3
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_4_Q4_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_4_Q4
+  []
+  [screw_Dislo_Den_Slip_4_Q4_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_4_Q4
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 3
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  # Slip 5
+  [Edge_Dislo_Den_Slip_5_Q1_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_5_Q1
+  []
+  [Edge_Dislo_Den_Slip_5_Q1_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_5_Q1
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 4
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [Edge_Dislo_Den_Slip_5_Q2_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_5_Q2
+  []
+  [Edge_Dislo_Den_Slip_5_Q2_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_5_Q2
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 4
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [Edge_Dislo_Den_Slip_5_Q3_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_5_Q3
+  []
+  [Edge_Dislo_Den_Slip_5_Q3_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_5_Q3
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 4
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [Edge_Dislo_Den_Slip_5_Q4_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_5_Q4
+  []
+  [Edge_Dislo_Den_Slip_5_Q4_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_5_Q4
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 4
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_5_Q1_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_5_Q1
+  []
+  [screw_Dislo_Den_Slip_5_Q1_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_5_Q1
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 4
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_5_Q2_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_5_Q2
+  []
+  [screw_Dislo_Den_Slip_5_Q2_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_5_Q2
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 4
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_5_Q3_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_5_Q3
+  []
+  [screw_Dislo_Den_Slip_5_Q3_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_5_Q3
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 4
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_5_Q4_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_5_Q4
+  []
+  [screw_Dislo_Den_Slip_5_Q4_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_5_Q4
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 4
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  # Slip 6
+  [Edge_Dislo_Den_Slip_6_Q1_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_6_Q1
+  []
+  [Edge_Dislo_Den_Slip_6_Q1_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_6_Q1
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 5
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [Edge_Dislo_Den_Slip_6_Q2_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_6_Q2
+  []
+  [Edge_Dislo_Den_Slip_6_Q2_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_6_Q2
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 5
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [Edge_Dislo_Den_Slip_6_Q3_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_6_Q3
+  []
+  [Edge_Dislo_Den_Slip_6_Q3_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_6_Q3
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 5
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [Edge_Dislo_Den_Slip_6_Q4_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_6_Q4
+  []
+  [Edge_Dislo_Den_Slip_6_Q4_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_6_Q4
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 5
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_6_Q1_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_6_Q1
+  []
+  [screw_Dislo_Den_Slip_6_Q1_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_6_Q1
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 5
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_6_Q2_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_6_Q2
+  []
+  [screw_Dislo_Den_Slip_6_Q2_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_6_Q2
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 5
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_6_Q3_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_6_Q3
+  []
+  [screw_Dislo_Den_Slip_6_Q3_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_6_Q3
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 5
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_6_Q4_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_6_Q4
+  []
+  [screw_Dislo_Den_Slip_6_Q4_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_6_Q4
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 5
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  # Slip 7 
+  [Edge_Dislo_Den_Slip_7_Q1_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_7_Q1
+  []
+  [Edge_Dislo_Den_Slip_7_Q1_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_7_Q1
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 6
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [Edge_Dislo_Den_Slip_7_Q2_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_7_Q2
+  []
+  [Edge_Dislo_Den_Slip_7_Q2_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_7_Q2
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 6
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [Edge_Dislo_Den_Slip_7_Q3_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_7_Q3
+  []
+  [Edge_Dislo_Den_Slip_7_Q3_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_7_Q3
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 6
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [Edge_Dislo_Den_Slip_7_Q4_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_7_Q4
+  []
+  [Edge_Dislo_Den_Slip_7_Q4_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_7_Q4
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 6
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_7_Q1_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_7_Q1
+  []
+  [screw_Dislo_Den_Slip_7_Q1_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_7_Q1
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 6
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_7_Q2_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_7_Q2
+  []
+  [screw_Dislo_Den_Slip_7_Q2_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_7_Q2
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 6
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_7_Q3_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_7_Q3
+  []
+  [screw_Dislo_Den_Slip_7_Q3_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_7_Q3
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 6
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_7_Q4_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_7_Q4
+  []
+  [screw_Dislo_Den_Slip_7_Q4_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_7_Q4
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 6
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  # Slip 8
+  [Edge_Dislo_Den_Slip_8_Q1_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_8_Q1
+  []
+  [Edge_Dislo_Den_Slip_8_Q1_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_8_Q1
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 7
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [Edge_Dislo_Den_Slip_8_Q2_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_8_Q2
+  []
+  [Edge_Dislo_Den_Slip_8_Q2_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_8_Q2
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 7
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [Edge_Dislo_Den_Slip_8_Q3_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_8_Q3
+  []
+  [Edge_Dislo_Den_Slip_8_Q3_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_8_Q3
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 7
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [Edge_Dislo_Den_Slip_8_Q4_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_8_Q4
+  []
+  [Edge_Dislo_Den_Slip_8_Q4_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_8_Q4
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 7
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_8_Q1_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_8_Q1
+  []
+  [screw_Dislo_Den_Slip_8_Q1_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_8_Q1
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 7
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_8_Q2_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_8_Q2
+  []
+  [screw_Dislo_Den_Slip_8_Q2_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_8_Q2
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 7
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_8_Q3_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_8_Q3
+  []
+  [screw_Dislo_Den_Slip_8_Q3_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_8_Q3
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 7
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_8_Q4_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_8_Q4
+  []
+  [screw_Dislo_Den_Slip_8_Q4_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_8_Q4
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 7
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  # Slip 9
+  [Edge_Dislo_Den_Slip_9_Q1_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_9_Q1
+  []
+  [Edge_Dislo_Den_Slip_9_Q1_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_9_Q1
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 8
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [Edge_Dislo_Den_Slip_9_Q2_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_9_Q2
+  []
+  [Edge_Dislo_Den_Slip_9_Q2_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_9_Q2
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 8
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [Edge_Dislo_Den_Slip_9_Q3_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_9_Q3
+  []
+  [Edge_Dislo_Den_Slip_9_Q3_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_9_Q3
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 8
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [Edge_Dislo_Den_Slip_9_Q4_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_9_Q4
+  []
+  [Edge_Dislo_Den_Slip_9_Q4_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_9_Q4
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 8
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_9_Q1_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_9_Q1
+  []
+  [screw_Dislo_Den_Slip_9_Q1_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_9_Q1
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 8
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_9_Q2_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_9_Q2
+  []
+  [screw_Dislo_Den_Slip_9_Q2_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_9_Q2
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 8
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_9_Q3_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_9_Q3
+  []
+  [screw_Dislo_Den_Slip_9_Q3_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_9_Q3
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 8
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_9_Q4_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_9_Q4
+  []
+  [screw_Dislo_Den_Slip_9_Q4_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_9_Q4
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 8
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  # Slip 10 
+  [Edge_Dislo_Den_Slip_10_Q1_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_10_Q1
+  []
+  [Edge_Dislo_Den_Slip_10_Q1_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_10_Q1
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 9
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [Edge_Dislo_Den_Slip_10_Q2_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_10_Q2
+  []
+  [Edge_Dislo_Den_Slip_10_Q2_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_10_Q2
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 9
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [Edge_Dislo_Den_Slip_10_Q3_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_10_Q3
+  []
+  [Edge_Dislo_Den_Slip_10_Q3_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_10_Q3
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 9
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [Edge_Dislo_Den_Slip_10_Q4_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_10_Q4
+  []
+  [Edge_Dislo_Den_Slip_10_Q4_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_10_Q4
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 9
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_10_Q1_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_10_Q1
+  []
+  [screw_Dislo_Den_Slip_10_Q1_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_10_Q1
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 9
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_10_Q2_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_10_Q2
+  []
+  [screw_Dislo_Den_Slip_10_Q2_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_10_Q2
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 9
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_10_Q3_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_10_Q3
+  []
+  [screw_Dislo_Den_Slip_10_Q3_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_10_Q3
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 9
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_10_Q4_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_10_Q4
+  []
+  [screw_Dislo_Den_Slip_10_Q4_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_10_Q4
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 9
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  # Slip 11 
+  [Edge_Dislo_Den_Slip_11_Q1_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_11_Q1
+  []
+  [Edge_Dislo_Den_Slip_11_Q1_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_11_Q1
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 10
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [Edge_Dislo_Den_Slip_11_Q2_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_11_Q2
+  []
+  [Edge_Dislo_Den_Slip_11_Q2_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_11_Q2
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 10
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [Edge_Dislo_Den_Slip_11_Q3_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_11_Q3
+  []
+  [Edge_Dislo_Den_Slip_11_Q3_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_11_Q3
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 10
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [Edge_Dislo_Den_Slip_11_Q4_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_11_Q4
+  []
+  [Edge_Dislo_Den_Slip_11_Q4_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_11_Q4
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 10
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_11_Q1_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_11_Q1
+  []
+  [screw_Dislo_Den_Slip_11_Q1_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_11_Q1
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 10
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_11_Q2_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_11_Q2
+  []
+  [screw_Dislo_Den_Slip_11_Q2_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_11_Q2
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 10
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_11_Q3_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_11_Q3
+  []
+  [screw_Dislo_Den_Slip_11_Q3_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_11_Q3
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 10
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_11_Q4_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_11_Q4
+  []
+  [screw_Dislo_Den_Slip_11_Q4_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_11_Q4
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 10
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  # Slip 12 
+  [Edge_Dislo_Den_Slip_12_Q1_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_12_Q1
+  []
+  [Edge_Dislo_Den_Slip_12_Q1_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_12_Q1
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 11
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [Edge_Dislo_Den_Slip_12_Q2_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_12_Q2
+  []
+  [Edge_Dislo_Den_Slip_12_Q2_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_12_Q2
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 11
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [Edge_Dislo_Den_Slip_12_Q3_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_12_Q3
+  []
+  [Edge_Dislo_Den_Slip_12_Q3_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_12_Q3
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 11
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [Edge_Dislo_Den_Slip_12_Q4_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_dislo_12_Q4
+  []
+  [Edge_Dislo_Den_Slip_12_Q4_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = edge_dislo_12_Q4
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 11
+      dislo_character = edge
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_12_Q1_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_12_Q1
+  []
+  [screw_Dislo_Den_Slip_12_Q1_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_12_Q1
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 11
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_12_Q2_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_12_Q2
+  []
+  [screw_Dislo_Den_Slip_12_Q2_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_12_Q2
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 11
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_12_Q3_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_12_Q3
+  []
+  [screw_Dislo_Den_Slip_12_Q3_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_12_Q3
+    upwinding_type = full
+      dislo_sign = negative
+      slip_sys_index = 11
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+
+  [screw_Dislo_Den_Slip_12_Q4_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_dislo_12_Q4
+  []
+  [screw_Dislo_Den_Slip_12_Q4_Flux]
+    type = ConservativeAdvectionSchmid
+    variable = screw_dislo_12_Q4
+    upwinding_type = full
+      dislo_sign = positive
+      slip_sys_index = 11
+      dislo_character = screw
+    is_ssd_included = yes
+  []
+[]
+
+[AuxKernels]
+  [./pk2]
+   type = RankTwoAux
+   variable = pk2
+   rank_two_tensor = second_piola_kirchhoff_stress
+   index_j = 0
+   index_i = 0
+   execute_on = timestep_end
+  [../]
+  [./fp_xx]
+    type = RankTwoAux
+    variable = fp_xx
+    rank_two_tensor = plastic_deformation_gradient
+    index_j = 0
+    index_i = 0
+    execute_on = timestep_end
+  [../]
+  [./e_xx]
+    type = RankTwoAux
+    variable = e_xx
+    rank_two_tensor = total_lagrangian_strain
+    index_j = 0
+    index_i = 0
+    execute_on = timestep_end
+  [../]
+  [./slip_inc]
+   type = MaterialStdVectorAux
+   variable = slip_increment
+   property = slip_increment
+   index = 1
+   execute_on = timestep_end
+  [../]
+  [slip_increments]
+    type = SlipSystemArrayAux
+    variable = slip_increments
+    quantity = slip_increment
+    execute_on = timestep_end
+  []
+  [total_densities]
+    type = SlipSystemArrayAux
+    variable = total_densities
+    quantity = total
+    initial_total_dislo_den = 16.e3
+    execute_on = timestep_end
+  []
+  [total_density_sum_1]
+    type = ParsedAux
+    variable = total_density_sum_1
+    coupled_variables = 'edge_dislo_1_Q1 edge_dislo_1_Q2 edge_dislo_1_Q3 edge_dislo_1_Q4 '
+                        'screw_dislo_1_Q1 screw_dislo_1_Q2 screw_dislo_1_Q3 screw_dislo_1_Q4'
+    expression = '(edge_dislo_1_Q1 + edge_dislo_1_Q2 + edge_dislo_1_Q3 + edge_dislo_1_Q4 + '
+                 'screw_dislo_1_Q1 + screw_dislo_1_Q2 + screw_dislo_1_Q3 + screw_dislo_1_Q4) / 16.e3'
+    execute_on = timestep_end
+  []
+  [./epeq]
+   type = MaterialRealAux
+   variable = epeq
+   property = accumulated_equivalent_plastic_strain
+   execute_on = timestep_end
+  [../]
+[]
+
+[BCs]
+  [./symmy]
+    type = DirichletBC
+    variable = disp_y
+    boundary = bottom
+    value = 0
+  [../]
+  [./symmx]
+    type = DirichletBC
+    variable = disp_x
+    boundary = left
+    value = 0
+  [../]
+  [./symmz]
+    type = DirichletBC
+    variable = disp_z
+    boundary = back
+    value = 0
+  [../]
+  [./tdisp]
+    type = FunctionDirichletBC
+    variable = disp_x
+    boundary = right #front
+    function = '0.003*t'
+  [../]
+[]
+
+[Materials]
+  [./elasticity_tensor]
+    type = ComputeElasticityTensorCP
+    C_ijkl = '168500.0 121500.0 121500.0 168500.0 121500.0 168500.0 75600.0 75600.0 75600.0'
+    fill_method = symmetric9
+    euler_angle_1 = 0.0
+    euler_angle_2 = 0.0
+    euler_angle_3 = 0.0
+  [../]
+  [./dislocation_state]
+    type = DislocationDensityState
+    number_slip_systems = 12
+    edge_dislo_den_1_Q1 = edge_dislo_1_Q1
+    edge_dislo_den_1_Q2 = edge_dislo_1_Q2
+    edge_dislo_den_1_Q3 = edge_dislo_1_Q3
+    edge_dislo_den_1_Q4 = edge_dislo_1_Q4
+    screw_dislo_den_1_Q1 = screw_dislo_1_Q1
+    screw_dislo_den_1_Q2 = screw_dislo_1_Q2
+    screw_dislo_den_1_Q3 = screw_dislo_1_Q3
+    screw_dislo_den_1_Q4 = screw_dislo_1_Q4
+    edge_dislo_den_2_Q1 = edge_dislo_2_Q1
+    edge_dislo_den_2_Q2 = edge_dislo_2_Q2
+    edge_dislo_den_2_Q3 = edge_dislo_2_Q3
+    edge_dislo_den_2_Q4 = edge_dislo_2_Q4
+    screw_dislo_den_2_Q1 = screw_dislo_2_Q1
+    screw_dislo_den_2_Q2 = screw_dislo_2_Q2
+    screw_dislo_den_2_Q3 = screw_dislo_2_Q3
+    screw_dislo_den_2_Q4 = screw_dislo_2_Q4
+    edge_dislo_den_3_Q1 = edge_dislo_3_Q1
+    edge_dislo_den_3_Q2 = edge_dislo_3_Q2
+    edge_dislo_den_3_Q3 = edge_dislo_3_Q3
+    edge_dislo_den_3_Q4 = edge_dislo_3_Q4
+    screw_dislo_den_3_Q1 = screw_dislo_3_Q1
+    screw_dislo_den_3_Q2 = screw_dislo_3_Q2
+    screw_dislo_den_3_Q3 = screw_dislo_3_Q3
+    screw_dislo_den_3_Q4 = screw_dislo_3_Q4
+    edge_dislo_den_4_Q1 = edge_dislo_4_Q1
+    edge_dislo_den_4_Q2 = edge_dislo_4_Q2
+    edge_dislo_den_4_Q3 = edge_dislo_4_Q3
+    edge_dislo_den_4_Q4 = edge_dislo_4_Q4
+    screw_dislo_den_4_Q1 = screw_dislo_4_Q1
+    screw_dislo_den_4_Q2 = screw_dislo_4_Q2
+    screw_dislo_den_4_Q3 = screw_dislo_4_Q3
+    screw_dislo_den_4_Q4 = screw_dislo_4_Q4
+    edge_dislo_den_5_Q1 = edge_dislo_5_Q1
+    edge_dislo_den_5_Q2 = edge_dislo_5_Q2
+    edge_dislo_den_5_Q3 = edge_dislo_5_Q3
+    edge_dislo_den_5_Q4 = edge_dislo_5_Q4
+    screw_dislo_den_5_Q1 = screw_dislo_5_Q1
+    screw_dislo_den_5_Q2 = screw_dislo_5_Q2
+    screw_dislo_den_5_Q3 = screw_dislo_5_Q3
+    screw_dislo_den_5_Q4 = screw_dislo_5_Q4
+    edge_dislo_den_6_Q1 = edge_dislo_6_Q1
+    edge_dislo_den_6_Q2 = edge_dislo_6_Q2
+    edge_dislo_den_6_Q3 = edge_dislo_6_Q3
+    edge_dislo_den_6_Q4 = edge_dislo_6_Q4
+    screw_dislo_den_6_Q1 = screw_dislo_6_Q1
+    screw_dislo_den_6_Q2 = screw_dislo_6_Q2
+    screw_dislo_den_6_Q3 = screw_dislo_6_Q3
+    screw_dislo_den_6_Q4 = screw_dislo_6_Q4
+    edge_dislo_den_7_Q1 = edge_dislo_7_Q1
+    edge_dislo_den_7_Q2 = edge_dislo_7_Q2
+    edge_dislo_den_7_Q3 = edge_dislo_7_Q3
+    edge_dislo_den_7_Q4 = edge_dislo_7_Q4
+    screw_dislo_den_7_Q1 = screw_dislo_7_Q1
+    screw_dislo_den_7_Q2 = screw_dislo_7_Q2
+    screw_dislo_den_7_Q3 = screw_dislo_7_Q3
+    screw_dislo_den_7_Q4 = screw_dislo_7_Q4
+    edge_dislo_den_8_Q1 = edge_dislo_8_Q1
+    edge_dislo_den_8_Q2 = edge_dislo_8_Q2
+    edge_dislo_den_8_Q3 = edge_dislo_8_Q3
+    edge_dislo_den_8_Q4 = edge_dislo_8_Q4
+    screw_dislo_den_8_Q1 = screw_dislo_8_Q1
+    screw_dislo_den_8_Q2 = screw_dislo_8_Q2
+    screw_dislo_den_8_Q3 = screw_dislo_8_Q3
+    screw_dislo_den_8_Q4 = screw_dislo_8_Q4
+    edge_dislo_den_9_Q1 = edge_dislo_9_Q1
+    edge_dislo_den_9_Q2 = edge_dislo_9_Q2
+    edge_dislo_den_9_Q3 = edge_dislo_9_Q3
+    edge_dislo_den_9_Q4 = edge_dislo_9_Q4
+    screw_dislo_den_9_Q1 = screw_dislo_9_Q1
+    screw_dislo_den_9_Q2 = screw_dislo_9_Q2
+    screw_dislo_den_9_Q3 = screw_dislo_9_Q3
+    screw_dislo_den_9_Q4 = screw_dislo_9_Q4
+    edge_dislo_den_10_Q1 = edge_dislo_10_Q1
+    edge_dislo_den_10_Q2 = edge_dislo_10_Q2
+    edge_dislo_den_10_Q3 = edge_dislo_10_Q3
+    edge_dislo_den_10_Q4 = edge_dislo_10_Q4
+    screw_dislo_den_10_Q1 = screw_dislo_10_Q1
+    screw_dislo_den_10_Q2 = screw_dislo_10_Q2
+    screw_dislo_den_10_Q3 = screw_dislo_10_Q3
+    screw_dislo_den_10_Q4 = screw_dislo_10_Q4
+    edge_dislo_den_11_Q1 = edge_dislo_11_Q1
+    edge_dislo_den_11_Q2 = edge_dislo_11_Q2
+    edge_dislo_den_11_Q3 = edge_dislo_11_Q3
+    edge_dislo_den_11_Q4 = edge_dislo_11_Q4
+    screw_dislo_den_11_Q1 = screw_dislo_11_Q1
+    screw_dislo_den_11_Q2 = screw_dislo_11_Q2
+    screw_dislo_den_11_Q3 = screw_dislo_11_Q3
+    screw_dislo_den_11_Q4 = screw_dislo_11_Q4
+    edge_dislo_den_12_Q1 = edge_dislo_12_Q1
+    edge_dislo_den_12_Q2 = edge_dislo_12_Q2
+    edge_dislo_den_12_Q3 = edge_dislo_12_Q3
+    edge_dislo_den_12_Q4 = edge_dislo_12_Q4
+    screw_dislo_den_12_Q1 = screw_dislo_12_Q1
+    screw_dislo_den_12_Q2 = screw_dislo_12_Q2
+    screw_dislo_den_12_Q3 = screw_dislo_12_Q3
+    screw_dislo_den_12_Q4 = screw_dislo_12_Q4
+  [../]
+  [./stress]
+    type = ComputeCrystalPlasticityDislocationStress
+    crystal_plasticity_models = 'trial_xtalpl'
+    tan_mod_type = exact
+  [../]
+  [./trial_xtalpl]
+    type = CrystalPlasticityBussoUpdateFCC
+    number_slip_systems = 12
+      w1 = 1.5
+      w2 = 1.2
+      tau_0 = 20.0
+      p = 0.2
+      q = 1.2
+      f0 = 2.77e-19
+      gdot0 = 1.e6
+    slip_sys_file_name = input_slip_fcc_sys.txt
+    dislocation_state = true
+  [../]
+  [./ssd]
+    type = SSDUpdate
+    nss = 12
+    dislocation_state = true
+  [../]
+[]
+
+[Postprocessors]
+  [wall_time]
+    type = PerfGraphData
+    section_name = 'FEProblem::solve'
+    data_type = TOTAL
+    must_exist = false
+  []
+  [nonlinear_its]
+    type = NumNonlinearIterations
+  []
+  [linear_its]
+    type = NumLinearIterations
+  []
+  [total_nonlinear_its]
+    type = CumulativeValuePostprocessor
+    postprocessor = nonlinear_its
+  []
+  [total_linear_its]
+    type = CumulativeValuePostprocessor
+    postprocessor = linear_its
+  []
+  [peak_memory]
+    type = MemoryUsage
+    mem_type = physical_memory
+    value_type = max_process
+    mem_units = megabytes
+  []
+  [./stress_xx]
+    type = ElementAverageValue
+    variable = stress_xx
+  [../]
+  [./pk2]
+   type = ElementAverageValue
+   variable = pk2
+  [../]
+  [./fp_xx]
+    type = ElementAverageValue
+    variable = fp_xx
+  [../]
+  [./e_xx]
+    type = ElementAverageValue
+    variable = e_xx
+  [../]
+  [./slip_increment]
+   type = ElementAverageValue
+   variable = slip_increment
+  [../]
+  [slip_increment_2]
+    type = ElementIntegralArrayVariablePostprocessor
+    variable = slip_increments
+    component = 1
+  []
+  [total_density_1]
+    type = ElementIntegralArrayVariablePostprocessor
+    variable = total_densities
+    component = 0
+  []
+  [total_density_sum_1]
+    type = ElementIntegralVariablePostprocessor
+    variable = total_density_sum_1
+  []
+  [./epeq]
+    type = ElementAverageValue
+    variable = epeq
+  [../]
+  [./disp_x]
+     type = NodalVariableValue
+     variable = disp_x
+     nodeid = 6
+  [../]
+  [./strain_xx]
+    type = ElementAverageValue
+    variable = strain_xx
+  [../]
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  petsc_options = '-snes_ksp_ew'
+  petsc_options_iname = '-pc_type -pc_hypre_type -ksp_gmres_restart'
+  petsc_options_value = 'lu    boomeramg          31'
+  line_search = 'none'
+  l_max_its = 50
+  nl_max_its = 50
+  nl_rel_tol = 1e-5
+  nl_abs_tol = 1e-3
+  l_tol = 1e-5
+
+  start_time = 0.0
+  num_steps = 5
+  dt = 5.e-4
+  dtmin = 1.e-9
+[]
+
+# The components of the array variables on the unit cube have to match the slip increment of
+# the second slip system and the normalised sum of the quadrant densities of the first one
+[UserObjects]
+  [check_arrays]
+    type = Terminator
+    expression = 'abs(slip_increment_2 - slip_increment) > 1e-12 * abs(slip_increment) + 1e-20 | '
+                 'abs(total_density_1 - total_density_sum_1) > 1e-12'
+    fail_mode = HARD
+    error_level = ERROR
+  []
+[]
+
+# The array variable postprocessors have their own file, so that the columns of the csv output
+# are those of single_crystal_one_element_reduced.i
+[Outputs]
+  [csv]
+    type = CSV
+    hide = 'wall_time nonlinear_its linear_its total_nonlinear_its total_linear_its peak_memory '
+           'slip_increment_2 total_density_1 total_density_sum_1'
+    execute_on = 'timestep_end'
+  []
+  [arrays]
+    type = CSV
+    file_base = single_crystal_dislocation_state_reduced_arrays
+    show = 'slip_increment_2 total_density_1 total_density_sum_1'
+    execute_on = 'timestep_end'
+  []
+  [perf]
+    type = CSV
+    file_base = single_crystal_dislocation_state_reduced_perf
+    show = 'wall_time total_nonlinear_its total_linear_its peak_memory'
+    execute_on = 'final'
+  []
+[]
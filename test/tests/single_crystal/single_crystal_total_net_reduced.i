@@ -0,0 +1,1032 @@
+# Reduced-size single crystal problem of single_crystal_one_element_reduced.i with the
+# total_net density formulation: one total and one GND density per character and slip
+# system (48 transported densities instead of 96 quadrant densities).
+
+[GlobalParams]
+  displacements = 'disp_x disp_y disp_z'
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 1
+  ny = 1
+  nz = 1
+  xmin = 0.0
+  ymin = 0.0
+  zmin = 0.0
+  xmax = 1.0
+  ymax = 1.0
+  zmax = 1.0
+  elem_type = HEX8
+[]
+
+[Variables]
+  [disp_x]
+    order = FIRST
+      family = LAGRANGE
+  []
+  [disp_y]
+    order = FIRST
+      family = LAGRANGE
+  []
+  [disp_z]
+    order = FIRST
+      family = LAGRANGE
+  []
+  [edge_total_1]
+    initial_condition = 8.e3
+  []
+  [edge_gnd_1]
+  []
+  [screw_total_1]
+    initial_condition = 8.e3
+  []
+  [screw_gnd_1]
+  []
+  [edge_total_2]
+    initial_condition = 8.e3
+  []
+  [edge_gnd_2]
+  []
+  [screw_total_2]
+    initial_condition = 8.e3
+  []
+  [screw_gnd_2]
+  []
+  [edge_total_3]
+    initial_condition = 8.e3
+  []
+  [edge_gnd_3]
+  []
+  [screw_total_3]
+    initial_condition = 8.e3
+  []
+  [screw_gnd_3]
+  []
+  [edge_total_4]
+    initial_condition = 8.e3
+  []
+  [edge_gnd_4]
+  []
+  [screw_total_4]
+    initial_condition = 8.e3
+  []
+  [screw_gnd_4]
+  []
+  [edge_total_5]
+    initial_condition = 8.e3
+  []
+  [edge_gnd_5]
+  []
+  [screw_total_5]
+    initial_condition = 8.e3
+  []
+  [screw_gnd_5]
+  []
+  [edge_total_6]
+    initial_condition = 8.e3
+  []
+  [edge_gnd_6]
+  []
+  [screw_total_6]
+    initial_condition = 8.e3
+  []
+  [screw_gnd_6]
+  []
+  [edge_total_7]
+    initial_condition = 8.e3
+  []
+  [edge_gnd_7]
+  []
+  [screw_total_7]
+    initial_condition = 8.e3
+  []
+  [screw_gnd_7]
+  []
+  [edge_total_8]
+    initial_condition = 8.e3
+  []
+  [edge_gnd_8]
+  []
+  [screw_total_8]
+    initial_condition = 8.e3
+  []
+  [screw_gnd_8]
+  []
+  [edge_total_9]
+    initial_condition = 8.e3
+  []
+  [edge_gnd_9]
+  []
+  [screw_total_9]
+    initial_condition = 8.e3
+  []
+  [screw_gnd_9]
+  []
+  [edge_total_10]
+    initial_condition = 8.e3
+  []
+  [edge_gnd_10]
+  []
+  [screw_total_10]
+    initial_condition = 8.e3
+  []
+  [screw_gnd_10]
+  []
+  [edge_total_11]
+    initial_condition = 8.e3
+  []
+  [edge_gnd_11]
+  []
+  [screw_total_11]
+    initial_condition = 8.e3
+  []
+  [screw_gnd_11]
+  []
+  [edge_total_12]
+    initial_condition = 8.e3
+  []
+  [edge_gnd_12]
+  []
+  [screw_total_12]
+    initial_condition = 8.e3
+  []
+  [screw_gnd_12]
+  []
+[]
+
+[AuxVariables]
+  [./pk2]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./fp_xx]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./e_xx]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./slip_increment]
+   order = CONSTANT
+   family = MONOMIAL
+  [../]
+  [./dislo_velocity]
+   order = CONSTANT
+   family = MONOMIAL
+  [../]
+  [./epeq]
+   order = CONSTANT
+   family = MONOMIAL
+  [../]
+[]
+
+[Physics/SolidMechanics/QuasiStatic/all]
+  strain = FINITE
+  add_variables = true
+  generate_output = 'stress_xx'
+  additional_generate_output = 'strain_xx'
+[]
+
+[Kernels]
+  # Slip 1
+  [edge_total_1_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_total_1
+  []
+  [edge_total_1_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = edge_total_1
+    paired_density = edge_gnd_1
+    upwinding_type = full
+    slip_sys_index = 0
+    dislo_character = edge
+    density_type = total
+  []
+  [edge_gnd_1_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_gnd_1
+  []
+  [edge_gnd_1_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = edge_gnd_1
+    paired_density = edge_total_1
+    upwinding_type = full
+    slip_sys_index = 0
+    dislo_character = edge
+    density_type = gnd
+  []
+  [screw_total_1_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_total_1
+  []
+  [screw_total_1_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = screw_total_1
+    paired_density = screw_gnd_1
+    upwinding_type = full
+    slip_sys_index = 0
+    dislo_character = screw
+    density_type = total
+  []
+  [screw_gnd_1_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_gnd_1
+  []
+  [screw_gnd_1_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = screw_gnd_1
+    paired_density = screw_total_1
+    upwinding_type = full
+    slip_sys_index = 0
+    dislo_character = screw
+    density_type = gnd
+  []
+  # Slip 2
+  [edge_total_2_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_total_2
+  []
+  [edge_total_2_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = edge_total_2
+    paired_density = edge_gnd_2
+    upwinding_type = full
+    slip_sys_index = 1
+    dislo_character = edge
+    density_type = total
+  []
+  [edge_gnd_2_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_gnd_2
+  []
+  [edge_gnd_2_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = edge_gnd_2
+    paired_density = edge_total_2
+    upwinding_type = full
+    slip_sys_index = 1
+    dislo_character = edge
+    density_type = gnd
+  []
+  [screw_total_2_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_total_2
+  []
+  [screw_total_2_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = screw_total_2
+    paired_density = screw_gnd_2
+    upwinding_type = full
+    slip_sys_index = 1
+    dislo_character = screw
+    density_type = total
+  []
+  [screw_gnd_2_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_gnd_2
+  []
+  [screw_gnd_2_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = screw_gnd_2
+    paired_density = screw_total_2
+    upwinding_type = full
+    slip_sys_index = 1
+    dislo_character = screw
+    density_type = gnd
+  []
+  # Slip 3
+  [edge_total_3_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_total_3
+  []
+  [edge_total_3_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = edge_total_3
+    paired_density = edge_gnd_3
+    upwinding_type = full
+    slip_sys_index = 2
+    dislo_character = edge
+    density_type = total
+  []
+  [edge_gnd_3_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_gnd_3
+  []
+  [edge_gnd_3_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = edge_gnd_3
+    paired_density = edge_total_3
+    upwinding_type = full
+    slip_sys_index = 2
+    dislo_character = edge
+    density_type = gnd
+  []
+  [screw_total_3_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_total_3
+  []
+  [screw_total_3_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = screw_total_3
+    paired_density = screw_gnd_3
+    upwinding_type = full
+    slip_sys_index = 2
+    dislo_character = screw
+    density_type = total
+  []
+  [screw_gnd_3_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_gnd_3
+  []
+  [screw_gnd_3_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = screw_gnd_3
+    paired_density = screw_total_3
+    upwinding_type = full
+    slip_sys_index = 2
+    dislo_character = screw
+    density_type = gnd
+  []
+  # Slip 4
+  [edge_total_4_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_total_4
+  []
+  [edge_total_4_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = edge_total_4
+    paired_density = edge_gnd_4
+    upwinding_type = full
+    slip_sys_index = 3
+    dislo_character = edge
+    density_type = total
+  []
+  [edge_gnd_4_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_gnd_4
+  []
+  [edge_gnd_4_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = edge_gnd_4
+    paired_density = edge_total_4
+    upwinding_type = full
+    slip_sys_index = 3
+    dislo_character = edge
+    density_type = gnd
+  []
+  [screw_total_4_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_total_4
+  []
+  [screw_total_4_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = screw_total_4
+    paired_density = screw_gnd_4
+    upwinding_type = full
+    slip_sys_index = 3
+    dislo_character = screw
+    density_type = total
+  []
+  [screw_gnd_4_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_gnd_4
+  []
+  [screw_gnd_4_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = screw_gnd_4
+    paired_density = screw_total_4
+    upwinding_type = full
+    slip_sys_index = 3
+    dislo_character = screw
+    density_type = gnd
+  []
+  # Slip 5
+  [edge_total_5_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_total_5
+  []
+  [edge_total_5_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = edge_total_5
+    paired_density = edge_gnd_5
+    upwinding_type = full
+    slip_sys_index = 4
+    dislo_character = edge
+    density_type = total
+  []
+  [edge_gnd_5_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_gnd_5
+  []
+  [edge_gnd_5_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = edge_gnd_5
+    paired_density = edge_total_5
+    upwinding_type = full
+    slip_sys_index = 4
+    dislo_character = edge
+    density_type = gnd
+  []
+  [screw_total_5_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_total_5
+  []
+  [screw_total_5_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = screw_total_5
+    paired_density = screw_gnd_5
+    upwinding_type = full
+    slip_sys_index = 4
+    dislo_character = screw
+    density_type = total
+  []
+  [screw_gnd_5_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_gnd_5
+  []
+  [screw_gnd_5_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = screw_gnd_5
+    paired_density = screw_total_5
+    upwinding_type = full
+    slip_sys_index = 4
+    dislo_character = screw
+    density_type = gnd
+  []
+  # Slip 6
+  [edge_total_6_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_total_6
+  []
+  [edge_total_6_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = edge_total_6
+    paired_density = edge_gnd_6
+    upwinding_type = full
+    slip_sys_index = 5
+    dislo_character = edge
+    density_type = total
+  []
+  [edge_gnd_6_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_gnd_6
+  []
+  [edge_gnd_6_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = edge_gnd_6
+    paired_density = edge_total_6
+    upwinding_type = full
+    slip_sys_index = 5
+    dislo_character = edge
+    density_type = gnd
+  []
+  [screw_total_6_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_total_6
+  []
+  [screw_total_6_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = screw_total_6
+    paired_density = screw_gnd_6
+    upwinding_type = full
+    slip_sys_index = 5
+    dislo_character = screw
+    density_type = total
+  []
+  [screw_gnd_6_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_gnd_6
+  []
+  [screw_gnd_6_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = screw_gnd_6
+    paired_density = screw_total_6
+    upwinding_type = full
+    slip_sys_index = 5
+    dislo_character = screw
+    density_type = gnd
+  []
+  # Slip 7
+  [edge_total_7_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_total_7
+  []
+  [edge_total_7_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = edge_total_7
+    paired_density = edge_gnd_7
+    upwinding_type = full
+    slip_sys_index = 6
+    dislo_character = edge
+    density_type = total
+  []
+  [edge_gnd_7_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_gnd_7
+  []
+  [edge_gnd_7_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = edge_gnd_7
+    paired_density = edge_total_7
+    upwinding_type = full
+    slip_sys_index = 6
+    dislo_character = edge
+    density_type = gnd
+  []
+  [screw_total_7_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_total_7
+  []
+  [screw_total_7_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = screw_total_7
+    paired_density = screw_gnd_7
+    upwinding_type = full
+    slip_sys_index = 6
+    dislo_character = screw
+    density_type = total
+  []
+  [screw_gnd_7_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_gnd_7
+  []
+  [screw_gnd_7_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = screw_gnd_7
+    paired_density = screw_total_7
+    upwinding_type = full
+    slip_sys_index = 6
+    dislo_character = screw
+    density_type = gnd
+  []
+  # Slip 8
+  [edge_total_8_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_total_8
+  []
+  [edge_total_8_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = edge_total_8
+    paired_density = edge_gnd_8
+    upwinding_type = full
+    slip_sys_index = 7
+    dislo_character = edge
+    density_type = total
+  []
+  [edge_gnd_8_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_gnd_8
+  []
+  [edge_gnd_8_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = edge_gnd_8
+    paired_density = edge_total_8
+    upwinding_type = full
+    slip_sys_index = 7
+    dislo_character = edge
+    density_type = gnd
+  []
+  [screw_total_8_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_total_8
+  []
+  [screw_total_8_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = screw_total_8
+    paired_density = screw_gnd_8
+    upwinding_type = full
+    slip_sys_index = 7
+    dislo_character = screw
+    density_type = total
+  []
+  [screw_gnd_8_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_gnd_8
+  []
+  [screw_gnd_8_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = screw_gnd_8
+    paired_density = screw_total_8
+    upwinding_type = full
+    slip_sys_index = 7
+    dislo_character = screw
+    density_type = gnd
+  []
+  # Slip 9
+  [edge_total_9_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_total_9
+  []
+  [edge_total_9_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = edge_total_9
+    paired_density = edge_gnd_9
+    upwinding_type = full
+    slip_sys_index = 8
+    dislo_character = edge
+    density_type = total
+  []
+  [edge_gnd_9_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_gnd_9
+  []
+  [edge_gnd_9_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = edge_gnd_9
+    paired_density = edge_total_9
+    upwinding_type = full
+    slip_sys_index = 8
+    dislo_character = edge
+    density_type = gnd
+  []
+  [screw_total_9_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_total_9
+  []
+  [screw_total_9_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = screw_total_9
+    paired_density = screw_gnd_9
+    upwinding_type = full
+    slip_sys_index = 8
+    dislo_character = screw
+    density_type = total
+  []
+  [screw_gnd_9_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_gnd_9
+  []
+  [screw_gnd_9_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = screw_gnd_9
+    paired_density = screw_total_9
+    upwinding_type = full
+    slip_sys_index = 8
+    dislo_character = screw
+    density_type = gnd
+  []
+  # Slip 10
+  [edge_total_10_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_total_10
+  []
+  [edge_total_10_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = edge_total_10
+    paired_density = edge_gnd_10
+    upwinding_type = full
+    slip_sys_index = 9
+    dislo_character = edge
+    density_type = total
+  []
+  [edge_gnd_10_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_gnd_10
+  []
+  [edge_gnd_10_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = edge_gnd_10
+    paired_density = edge_total_10
+    upwinding_type = full
+    slip_sys_index = 9
+    dislo_character = edge
+    density_type = gnd
+  []
+  [screw_total_10_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_total_10
+  []
+  [screw_total_10_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = screw_total_10
+    paired_density = screw_gnd_10
+    upwinding_type = full
+    slip_sys_index = 9
+    dislo_character = screw
+    density_type = total
+  []
+  [screw_gnd_10_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_gnd_10
+  []
+  [screw_gnd_10_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = screw_gnd_10
+    paired_density = screw_total_10
+    upwinding_type = full
+    slip_sys_index = 9
+    dislo_character = screw
+    density_type = gnd
+  []
+  # Slip 11
+  [edge_total_11_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_total_11
+  []
+  [edge_total_11_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = edge_total_11
+    paired_density = edge_gnd_11
+    upwinding_type = full
+    slip_sys_index = 10
+    dislo_character = edge
+    density_type = total
+  []
+  [edge_gnd_11_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_gnd_11
+  []
+  [edge_gnd_11_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = edge_gnd_11
+    paired_density = edge_total_11
+    upwinding_type = full
+    slip_sys_index = 10
+    dislo_character = edge
+    density_type = gnd
+  []
+  [screw_total_11_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_total_11
+  []
+  [screw_total_11_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = screw_total_11
+    paired_density = screw_gnd_11
+    upwinding_type = full
+    slip_sys_index = 10
+    dislo_character = screw
+    density_type = total
+  []
+  [screw_gnd_11_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_gnd_11
+  []
+  [screw_gnd_11_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = screw_gnd_11
+    paired_density = screw_total_11
+    upwinding_type = full
+    slip_sys_index = 10
+    dislo_character = screw
+    density_type = gnd
+  []
+  # Slip 12
+  [edge_total_12_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_total_12
+  []
+  [edge_total_12_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = edge_total_12
+    paired_density = edge_gnd_12
+    upwinding_type = full
+    slip_sys_index = 11
+    dislo_character = edge
+    density_type = total
+  []
+  [edge_gnd_12_Time]
+    type = MassLumpedTimeDerivative
+    variable = edge_gnd_12
+  []
+  [edge_gnd_12_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = edge_gnd_12
+    paired_density = edge_total_12
+    upwinding_type = full
+    slip_sys_index = 11
+    dislo_character = edge
+    density_type = gnd
+  []
+  [screw_total_12_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_total_12
+  []
+  [screw_total_12_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = screw_total_12
+    paired_density = screw_gnd_12
+    upwinding_type = full
+    slip_sys_index = 11
+    dislo_character = screw
+    density_type = total
+  []
+  [screw_gnd_12_Time]
+    type = MassLumpedTimeDerivative
+    variable = screw_gnd_12
+  []
+  [screw_gnd_12_Flux]
+    type = ConservativeAdvectionSchmidTotalNet
+    variable = screw_gnd_12
+    paired_density = screw_total_12
+    upwinding_type = full
+    slip_sys_index = 11
+    dislo_character = screw
+    density_type = gnd
+  []
+[]
+
+[AuxKernels]
+  [./pk2]
+   type = RankTwoAux
+   variable = pk2
+   rank_two_tensor = second_piola_kirchhoff_stress
+   index_j = 0
+   index_i = 0
+   execute_on = timestep_end
+  [../]
+  [./fp_xx]
+    type = RankTwoAux
+    variable = fp_xx
+    rank_two_tensor = plastic_deformation_gradient
+    index_j = 0
+    index_i = 0
+    execute_on = timestep_end
+  [../]
+  [./e_xx]
+    type = RankTwoAux
+    variable = e_xx
+    rank_two_tensor = total_lagrangian_strain
+    index_j = 0
+    index_i = 0
+    execute_on = timestep_end
+  [../]
+  [./slip_inc]
+   type = MaterialStdVectorAux
+   variable = slip_increment
+   property = slip_increment
+   index = 1
+   execute_on = timestep_end
+  [../]
+  [./epeq]
+   type = MaterialRealAux
+   variable = epeq
+   property = accumulated_equivalent_plastic_strain
+   execute_on = timestep_end
+  [../]
+[]
+
+[BCs]
+  [./symmy]
+    type = DirichletBC
+    variable = disp_y
+    boundary = bottom
+    value = 0
+  [../]
+  [./symmx]
+    type = DirichletBC
+    variable = disp_x
+    boundary = left
+    value = 0
+  [../]
+  [./symmz]
+    type = DirichletBC
+    variable = disp_z
+    boundary = back
+    value = 0
+  [../]
+  [./tdisp]
+    type = FunctionDirichletBC
+    variable = disp_x
+    boundary = right #front
+    function = '0.003*t'
+  [../]
+[]
+
+[Materials]
+  [./elasticity_tensor]
+    type = ComputeElasticityTensorCP
+    C_ijkl = '168500.0 121500.0 121500.0 168500.0 121500.0 168500.0 75600.0 75600.0 75600.0'
+    fill_method = symmetric9
+    euler_angle_1 = 0.0
+    euler_angle_2 = 0.0
+    euler_angle_3 = 0.0
+  [../]
+  [./stress]
+    type = ComputeCrystalPlasticityDislocationStress
+    crystal_plasticity_models = 'trial_xtalpl'
+    tan_mod_type = exact
+  [../]
+  [./trial_xtalpl]
+    type = CrystalPlasticityBussoUpdateFCC
+    number_slip_systems = 12
+      w1 = 1.5
+      w2 = 1.2
+      tau_0 = 20.0
+      p = 0.2
+      q = 1.2
+      f0 = 2.77e-19
+      gdot0 = 1.e6
+    slip_sys_file_name = input_slip_fcc_sys.txt
+    density_formulation = total_net
+    edge_total_densities = 'edge_total_1 edge_total_2 edge_total_3 edge_total_4 edge_total_5 edge_total_6 edge_total_7 edge_total_8 edge_total_9 edge_total_10 edge_total_11 edge_total_12'
+    edge_gnd_densities = 'edge_gnd_1 edge_gnd_2 edge_gnd_3 edge_gnd_4 edge_gnd_5 edge_gnd_6 edge_gnd_7 edge_gnd_8 edge_gnd_9 edge_gnd_10 edge_gnd_11 edge_gnd_12'
+    screw_total_densities = 'screw_total_1 screw_total_2 screw_total_3 screw_total_4 screw_total_5 screw_total_6 screw_total_7 screw_total_8 screw_total_9 screw_total_10 screw_total_11 screw_total_12'
+    screw_gnd_densities = 'screw_gnd_1 screw_gnd_2 screw_gnd_3 screw_gnd_4 screw_gnd_5 screw_gnd_6 screw_gnd_7 screw_gnd_8 screw_gnd_9 screw_gnd_10 screw_gnd_11 screw_gnd_12'
+  [../]
+[]
+
+[Postprocessors]
+  [wall_time]
+    type = PerfGraphData
+    section_name = 'FEProblem::solve'
+    data_type = TOTAL
+    must_exist = false
+  []
+  [nonlinear_its]
+    type = NumNonlinearIterations
+  []
+  [linear_its]
+    type = NumLinearIterations
+  []
+  [total_nonlinear_its]
+    type = CumulativeValuePostprocessor
+    postprocessor = nonlinear_its
+  []
+  [total_linear_its]
+    type = CumulativeValuePostprocessor
+    postprocessor = linear_its
+  []
+  [peak_memory]
+    type = MemoryUsage
+    mem_type = physical_memory
+    value_type = max_process
+    mem_units = megabytes
+  []
+  [./stress_xx]
+    type = ElementAverageValue
+    variable = stress_xx
+  [../]
+  [./pk2]
+   type = ElementAverageValue
+   variable = pk2
+  [../]
+  [./fp_xx]
+    type = ElementAverageValue
+    variable = fp_xx
+  [../]
+  [./e_xx]
+    type = ElementAverageValue
+    variable = e_xx
+  [../]
+  [./slip_increment]
+   type = ElementAverageValue
+   variable = slip_increment
+  [../]
+  [./epeq]
+    type = ElementAverageValue
+    variable = epeq
+  [../]
+  [./disp_x]
+     type = NodalVariableValue
+     variable = disp_x
+     nodeid = 6
+  [../]
+  [./strain_xx]
+    type = ElementAverageValue
+    variable = strain_xx
+  [../]
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  petsc_options = '-snes_ksp_ew'
+  petsc_options_iname = '-pc_type -pc_hypre_type -ksp_gmres_restart'
+  petsc_options_value = 'lu    boomeramg          31'
+  line_search = 'none'
+  l_max_its = 50
+  nl_max_its = 50
+  nl_rel_tol = 1e-5
+  nl_abs_tol = 1e-3
+  l_tol = 1e-5
+
+  start_time = 0.0
+  num_steps = 5
+  dt = 5.e-4
+  dtmin = 1.e-9
+[]
+
+[Outputs]
+  [csv]
+    type = CSV
+    hide = 'wall_time nonlinear_its linear_its total_nonlinear_its total_linear_its peak_memory'
+    execute_on = 'timestep_end'
+  []
+  [perf]
+    type = CSV
+    file_base = single_crystal_total_net_reduced_perf
+    show = 'wall_time total_nonlinear_its total_linear_its peak_memory'
+    execute_on = 'final'
+  []
+[]
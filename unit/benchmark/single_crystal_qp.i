@@ -0,0 +1,166 @@
+# Single HEX8 element used by cdf_update-bench to time one material update of
+# CrystalPlasticityBussoUpdateFCC + ComputeCrystalPlasticityDislocationStress.
+# The deformation is imposed through the initial condition of the displacements,
+# the benchmark overrides Functions/shear/expression to select the loading state.
+# Dislocation densities are coupled as constants, so no transport variables exist.
+
+[GlobalParams]
+  displacements = 'disp_x disp_y disp_z'
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 1
+  ny = 1
+  nz = 1
+  elem_type = HEX8
+[]
+
+[Functions]
+  [shear]
+    type = ParsedFunction
+    expression = '1.0e-5 * y'
+  []
+[]
+
+[Physics/SolidMechanics/QuasiStatic/all]
+  strain = FINITE
+  add_variables = true
+[]
+
+[ICs]
+  [disp_x]
+    type = FunctionIC
+    variable = disp_x
+    function = shear
+  []
+[]
+
+[Materials]
+  [elasticity_tensor]
+    type = ComputeElasticityTensorCP
+    C_ijkl = '168500.0 121500.0 121500.0 168500.0 121500.0 168500.0 75600.0 75600.0 75600.0'
+    fill_method = symmetric9
+  []
+  [stress]
+    type = ComputeCrystalPlasticityDislocationStress
+    crystal_plasticity_models = 'trial_xtalpl'
+    tan_mod_type = exact
+  []
+  [trial_xtalpl]
+    type = CrystalPlasticityBussoUpdateFCC
+    number_slip_systems = 12
+    w1 = 1.5
+    w2 = 1.2
+    tau_0 = 20.0
+    p = 0.2
+    q = 1.2
+    f0 = 2.77e-19
+    gdot0 = 1.e6
+    is_two_slips = no
+    slip_sys_file_name = input_slip_fcc_sys.txt
+    edge_dislo_den_1_Q1 = 2.e3
+    edge_dislo_den_1_Q2 = 2.e3
+    edge_dislo_den_1_Q3 = 2.e3
+    edge_dislo_den_1_Q4 = 2.e3
+    screw_dislo_den_1_Q1 = 2.e3
+    screw_dislo_den_1_Q2 = 2.e3
+    screw_dislo_den_1_Q3 = 2.e3
+    screw_dislo_den_1_Q4 = 2.e3
+    edge_dislo_den_2_Q1 = 2.e3
+    edge_dislo_den_2_Q2 = 2.e3
+    edge_dislo_den_2_Q3 = 2.e3
+    edge_dislo_den_2_Q4 = 2.e3
+    screw_dislo_den_2_Q1 = 2.e3
+    screw_dislo_den_2_Q2 = 2.e3
+    screw_dislo_den_2_Q3 = 2.e3
+    screw_dislo_den_2_Q4 = 2.e3
+    edge_dislo_den_3_Q1 = 2.e3
+    edge_dislo_den_3_Q2 = 2.e3
+    edge_dislo_den_3_Q3 = 2.e3
+    edge_dislo_den_3_Q4 = 2.e3
+    screw_dislo_den_3_Q1 = 2.e3
+    screw_dislo_den_3_Q2 = 2.e3
+    screw_dislo_den_3_Q3 = 2.e3
+    screw_dislo_den_3_Q4 = 2.e3
+    edge_dislo_den_4_Q1 = 2.e3
+    edge_dislo_den_4_Q2 = 2.e3
+    edge_dislo_den_4_Q3 = 2.e3
+    edge_dislo_den_4_Q4 = 2.e3
+    screw_dislo_den_4_Q1 = 2.e3
+    screw_dislo_den_4_Q2 = 2.e3
+    screw_dislo_den_4_Q3 = 2.e3
+    screw_dislo_den_4_Q4 = 2.e3
+    edge_dislo_den_5_Q1 = 2.e3
+    edge_dislo_den_5_Q2 = 2.e3
+    edge_dislo_den_5_Q3 = 2.e3
+    edge_dislo_den_5_Q4 = 2.e3
+    screw_dislo_den_5_Q1 = 2.e3
+    screw_dislo_den_5_Q2 = 2.e3
+    screw_dislo_den_5_Q3 = 2.e3
+    screw_dislo_den_5_Q4 = 2.e3
+    edge_dislo_den_6_Q1 = 2.e3
+    edge_dislo_den_6_Q2 = 2.e3
+    edge_dislo_den_6_Q3 = 2.e3
+    edge_dislo_den_6_Q4 = 2.e3
+    screw_dislo_den_6_Q1 = 2.e3
+    screw_dislo_den_6_Q2 = 2.e3
+    screw_dislo_den_6_Q3 = 2.e3
+    screw_dislo_den_6_Q4 = 2.e3
+    edge_dislo_den_7_Q1 = 2.e3
+    edge_dislo_den_7_Q2 = 2.e3
+    edge_dislo_den_7_Q3 = 2.e3
+    edge_dislo_den_7_Q4 = 2.e3
+    screw_dislo_den_7_Q1 = 2.e3
+    screw_dislo_den_7_Q2 = 2.e3
+    screw_dislo_den_7_Q3 = 2.e3
+    screw_dislo_den_7_Q4 = 2.e3
+    edge_dislo_den_8_Q1 = 2.e3
+    edge_dislo_den_8_Q2 = 2.e3
+    edge_dislo_den_8_Q3 = 2.e3
+    edge_dislo_den_8_Q4 = 2.e3
+    screw_dislo_den_8_Q1 = 2.e3
+    screw_dislo_den_8_Q2 = 2.e3
+    screw_dislo_den_8_Q3 = 2.e3
+    screw_dislo_den_8_Q4 = 2.e3
+    edge_dislo_den_9_Q1 = 2.e3
+    edge_dislo_den_9_Q2 = 2.e3
+    edge_dislo_den_9_Q3 = 2.e3
+    edge_dislo_den_9_Q4 = 2.e3
+    screw_dislo_den_9_Q1 = 2.e3
+    screw_dislo_den_9_Q2 = 2.e3
+    screw_dislo_den_9_Q3 = 2.e3
+    screw_dislo_den_9_Q4 = 2.e3
+    edge_dislo_den_10_Q1 = 2.e3
+    edge_dislo_den_10_Q2 = 2.e3
+    edge_dislo_den_10_Q3 = 2.e3
+    edge_dislo_den_10_Q4 = 2.e3
+    screw_dislo_den_10_Q1 = 2.e3
+    screw_dislo_den_10_Q2 = 2.e3
+    screw_dislo_den_10_Q3 = 2.e3
+    screw_dislo_den_10_Q4 = 2.e3
+    edge_dislo_den_11_Q1 = 2.e3
+    edge_dislo_den_11_Q2 = 2.e3
+    edge_dislo_den_11_Q3 = 2.e3
+    edge_dislo_den_11_Q4 = 2.e3
+    screw_dislo_den_11_Q1 = 2.e3
+    screw_dislo_den_11_Q2 = 2.e3
+    screw_dislo_den_11_Q3 = 2.e3
+    screw_dislo_den_11_Q4 = 2.e3
+    edge_dislo_den_12_Q1 = 2.e3
+    edge_dislo_den_12_Q2 = 2.e3
+    edge_dislo_den_12_Q3 = 2.e3
+    edge_dislo_den_12_Q4 = 2.e3
+    screw_dislo_den_12_Q1 = 2.e3
+    screw_dislo_den_12_Q2 = 2.e3
+    screw_dislo_den_12_Q3 = 2.e3
+    screw_dislo_den_12_Q4 = 2.e3
+  []
+[]
+
+[Executioner]
+  type = Transient
+  dt = 1.e-3
+  num_steps = 1
+[]